@@ -0,0 +1,271 @@
+/**
+  ******************************************************************************
+  * @file	: 14_MPBttnPollGrp_1a.cpp
+  * @brief  : Example for the ButtonToSwitch for STM32 library MPBttnPollGrp class
+  *
+  * The example benchmarks the MPBttnPollGrp ports snapshot mode using:
+  * 	- 16 DbncdMPBttn objects attached to the 16 pins of the GPIO_B port
+  * 	- The Nucleo board user LED attached to GPIO_A05 to signal the end of the benchmark
+  *
+  * ### This example creates one Task:
+  *
+  * The task instantiates the MPB objects, registers them in a MPBttnPollGrp object
+  * and executes a fixed number of scans by invoking the scanMPBttns() method directly,
+  * first with the ports snapshot mode disabled (each object reading it's own pin) and
+  * then with the ports snapshot mode enabled (the GPIO_B port read once per scan).
+  * For each mode the input reads per scan and the mean and worst case scan times
+  * are kept in the bnchmrkRslts array, to be inspected with the debugger once the
+  * user LED is turned on.
+  *
+  * 	@author	: Gabriel D. Goldman
+  *
+  * 	@date	: 	01/01/2024 First release
+  * 				07/07/2024 Last update
+  *
+  ******************************************************************************
+  * @attention	This file is part of the Examples folder for the ButtonToSwitch for STM32
+  * library. All files needed are provided as part of the source code for the library.
+  *
+  ******************************************************************************
+  */
+//----------------------- BEGIN Specific to use STM32F4xxyy testing platform
+#define MCU_SPEC
+//======================> Replace the following two lines with the files corresponding with the used STM32 configuration files
+#include "stm32f4xx_hal.h"
+#include "stm32f4xx_hal_gpio.h"
+//----------------------- End Specific to use STM32F4xxyy testing platform
+
+/* Private includes ----------------------------------------------------------*/
+//===========================>> Next lines used to avoid CMSIS wrappers
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+//===========================>> Previous lines used to avoid CMSIS wrappers
+/* USER CODE BEGIN Includes */
+#include "../../ButtonToSwitch_STM32/src/ButtonToSwitch_STM32.h"
+/* USER CODE END Includes */
+
+/* Private variables ---------------------------------------------------------*/
+/* USER CODE BEGIN PV */
+gpioPinId_t tstLedOnBoard{GPIOA, GPIO_PIN_5};	// Pin 0b 0000 0000 0010 0000
+GPIO_TypeDef* tstMpbsPort{GPIOB};	// The 16 pins of the port are used as MPB inputs
+
+const unsigned long int bnchmrkScansQty{1000};
+
+struct bnchmrkRslt_t{
+	unsigned long int inptRdsPerScan;
+	unsigned long int scanMeanUs;
+	unsigned long int scanMaxUs;
+};
+bnchmrkRslt_t bnchmrkRslts[2]{};	// [0]: ports snapshot disabled, [1]: ports snapshot enabled
+
+TaskHandle_t mainCtrlTskHndl {NULL};
+BaseType_t xReturned;
+/* USER CODE END PV */
+
+/* Private function prototypes -----------------------------------------------*/
+void SystemClock_Config(void);
+static void MX_GPIO_Init(void);
+void Error_Handler(void);
+
+/* USER CODE BEGIN FP */
+void mainCtrlTsk(void *pvParameters);
+/* USER CODE END FP */
+
+/**
+  * @brief  The application entry point.
+  * @retval int
+  */
+int main(void)
+{
+  /* MCU Configuration--------------------------------------------------------*/
+
+  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
+  HAL_Init();
+
+  /* Configure the system clock */
+  SystemClock_Config();
+
+  /* Initialize all configured peripherals */
+  MX_GPIO_Init();
+
+  /* Create the thread(s) */
+  /* USER CODE BEGIN RTOS_THREADS */
+  xReturned = xTaskCreate(
+		  mainCtrlTsk, //taskFunction
+		  "MainControlTask", //Task function legible name
+		  256, // Stack depth in words
+		  NULL,	//Parameters to pass as arguments to the taskFunction
+		  configTIMER_TASK_PRIORITY,	//Set to the same priority level as the software timers
+		  &mainCtrlTskHndl);
+  if(xReturned != pdPASS)
+	  Error_Handler();
+/* USER CODE END RTOS_THREADS */
+
+  /* Start scheduler */
+  vTaskStartScheduler();
+
+  /* We should never get here as control is now taken by the scheduler */
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+/* USER CODE BEGIN */
+void mainCtrlTsk(void *pvParameters)
+{
+	DbncdMPBttn* tstBttns[16]{};
+	MPBttnPollGrp tstPollGrp("BnchmrkGrp");
+	MpbPollLaneLtncy_t scanTms{};
+
+	for(uint8_t pinNum{0}; pinNum < 16; ++pinNum){
+		tstBttns[pinNum] = new DbncdMPBttn(tstMpbsPort, (uint16_t)(1 << pinNum), true, true, 50);
+		tstPollGrp.addMPBttn(tstBttns[pinNum]);
+	}
+
+	for(uint8_t bnchmrkMode{0}; bnchmrkMode < 2; ++bnchmrkMode){
+		tstPollGrp.setPortsSnpsht(bnchmrkMode == 1);
+		tstPollGrp.resetLanesLtncy();
+		for(unsigned long int scanNum{0}; scanNum < bnchmrkScansQty; ++scanNum){
+			tstPollGrp.scanMPBttns();
+			vTaskDelay(1);
+		}
+		scanTms = tstPollGrp.getLaneLtncy(0);	//All the objects are in the ordinary lane, the lane scan position is the scan time
+		bnchmrkRslts[bnchmrkMode].inptRdsPerScan = tstPollGrp.getLastScanInptRdsQty();
+		bnchmrkRslts[bnchmrkMode].scanMeanUs = scanTms.scanPosMeanUs;
+		bnchmrkRslts[bnchmrkMode].scanMaxUs = scanTms.scanPosMaxUs;
+	}
+	HAL_GPIO_WritePin(tstLedOnBoard.portId, tstLedOnBoard.pinNum, GPIO_PIN_SET);
+
+	for(;;)
+	{
+		vTaskDelay(1000);
+	}
+}
+/* USER CODE END */
+
+
+/**
+  * @brief System Clock Configuration
+  * @retval None
+  */
+void SystemClock_Config(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+  /** Configure the main internal regulator output voltage
+  */
+  __HAL_RCC_PWR_CLK_ENABLE();
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+  /** Initializes the RCC Oscillators according to the specified parameters
+  * in the RCC_OscInitTypeDef structure.
+  */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+  RCC_OscInitStruct.HSIState = RCC_HSI_ON;
+  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+  RCC_OscInitStruct.PLL.PLLM = 16;
+  RCC_OscInitStruct.PLL.PLLN = 336;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV4;
+  RCC_OscInitStruct.PLL.PLLQ = 4;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Initializes the CPU, AHB and APB buses clocks
+  */
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV2;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief GPIO Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_GPIO_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  /* GPIO Ports Clock Enable */
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  __HAL_RCC_GPIOH_CLK_ENABLE();
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+
+  /*Configure GPIO pins : tstMpbsPort all pins */
+  GPIO_InitStruct.Pin = GPIO_PIN_All;
+  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Pull = GPIO_PULLUP;
+  HAL_GPIO_Init(tstMpbsPort, &GPIO_InitStruct);
+
+  /*Configure GPIO pin Output Level for tstLedOnBoard*/
+  HAL_GPIO_WritePin(tstLedOnBoard.portId, tstLedOnBoard.pinNum, GPIO_PIN_RESET);
+
+  /*Configure GPIO pin : tstLedOnBoard_Pin */
+  GPIO_InitStruct.Pin = tstLedOnBoard.pinNum;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(tstLedOnBoard.portId, &GPIO_InitStruct);
+}
+
+/**
+  * @brief  Period elapsed callback in non blocking mode
+  * @note   This function is called  when TIM9 interrupt took place, inside
+  * HAL_TIM_IRQHandler(). It makes a direct call to HAL_IncTick() to increment
+  * a global variable "uwTick" used as application time base.
+  * @param  htim : TIM handle
+  * @retval None
+  */
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+  if (htim->Instance == TIM9) {
+    HAL_IncTick();
+  }
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @retval None
+  */
+void Error_Handler(void)
+{
+  /* USER CODE BEGIN Error_Handler_Debug */
+  /* User can add his own implementation to report the HAL error return state */
+  __disable_irq();
+  while (1)
+  {
+  }
+  /* USER CODE END Error_Handler_Debug */
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t *file, uint32_t line)
+{
+  /* USER CODE BEGIN 6 */
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+  /* USER CODE END 6 */
+}
+#endif /* USE_FULL_ASSERT */
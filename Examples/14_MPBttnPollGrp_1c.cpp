@@ -0,0 +1,315 @@
+/**
+  ******************************************************************************
+  * @file	: 14_MPBttnPollGrp_1c.cpp
+  * @brief  : Example for the ButtonToSwitch for STM32 library MPBttnPollGrp class
+  *
+  * The example measures the MPBttnPollGrp priority lanes press latency under load using:
+  * 	- A LpbckInptSrc object providing software set inputs, so no input hardware is needed
+  * 	- A DbncdMPBttn object registered in the highest priority lane
+  * 	- A DbncdMPBttn object registered in the ordinary lane, as the ordinary lane reference
+  * 	- Up to 96 DbncdMPBttn objects registered in the ordinary lane as load
+  * 	- The Nucleo board user LED attached to GPIO_A05 to signal the result
+  *
+  * ### This example creates one Task:
+  *
+  * The task instantiates the MPB objects, registers them in a MPBttnPollGrp object
+  * and executes the scans by invoking the scanMPBttns() method directly at a fixed
+  * period. For each load level the inputs of that quantity of load objects are
+  * toggled every scan, keeping them bouncing and serviced by every scan, while the
+  * two reference objects are pressed and released a fixed number of times.
+  * For each load level the worst case press latency and scan position of the
+  * priority and ordinary lanes are kept in the bnchmrkRslts array, to be inspected
+  * with the debugger. The user LED is turned on if the priority lane worst case
+  * press latency stayed in the expected bound for every load level.
+  *
+  * 	@author	: Gabriel D. Goldman
+  *
+  * 	@date	: 	01/01/2024 First release
+  * 				07/07/2024 Last update
+  *
+  ******************************************************************************
+  * @attention	This file is part of the Examples folder for the ButtonToSwitch for STM32
+  * library. All files needed are provided as part of the source code for the library.
+  *
+  ******************************************************************************
+  */
+//----------------------- BEGIN Specific to use STM32F4xxyy testing platform
+#define MCU_SPEC
+//======================> Replace the following two lines with the files corresponding with the used STM32 configuration files
+#include "stm32f4xx_hal.h"
+#include "stm32f4xx_hal_gpio.h"
+//----------------------- End Specific to use STM32F4xxyy testing platform
+
+/* Private includes ----------------------------------------------------------*/
+//===========================>> Next lines used to avoid CMSIS wrappers
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+//===========================>> Previous lines used to avoid CMSIS wrappers
+/* USER CODE BEGIN Includes */
+#include "../../ButtonToSwitch_STM32/src/ButtonToSwitch_STM32.h"
+/* USER CODE END Includes */
+
+/* Private variables ---------------------------------------------------------*/
+/* USER CODE BEGIN PV */
+gpioPinId_t tstLedOnBoard{GPIOA, GPIO_PIN_5};	// Pin 0b 0000 0000 0010 0000
+
+const uint8_t tstPrtyLane{3};	// The highest priority lane
+const uint16_t tstPrtyInptId{0};	// Priority lane reference object input
+const uint16_t tstOrdnrInptId{1};	// Ordinary lane reference object input
+const uint16_t tstLdFrstInptId{2};	// First load object input
+const uint8_t tstLdLvlsQty{4};
+const uint16_t tstLdLvls[tstLdLvlsQty]{0, 16, 48, 96};	// Quantity of active load objects for each load level
+const uint16_t tstInptsQty{tstLdFrstInptId + 96};
+const unsigned long int tstDbncTime{20};
+const unsigned long int tstScanPrd{5};
+const unsigned long int tstPrssCclsQty{20};
+//A validated press turns the DbncdMPBttn On in the next service, so it's notified at most two scan periods after being due
+const unsigned long int tstPrtyLtncyBoundUs{2 * tstScanPrd * 1000};
+
+struct bnchmrkRslt_t{
+	unsigned long int prssLtncyMaxUs[2];	// [0]: priority lane, [1]: ordinary lane
+	unsigned long int scanPosMaxUs[2];	// [0]: priority lane, [1]: ordinary lane
+};
+bnchmrkRslt_t bnchmrkRslts[tstLdLvlsQty]{};
+bool tstRslt{true};
+
+TaskHandle_t mainCtrlTskHndl {NULL};
+BaseType_t xReturned;
+/* USER CODE END PV */
+
+/* Private function prototypes -----------------------------------------------*/
+void SystemClock_Config(void);
+static void MX_GPIO_Init(void);
+void Error_Handler(void);
+
+/* USER CODE BEGIN FP */
+void mainCtrlTsk(void *pvParameters);
+void tstScans(MPBttnPollGrp &pollGrp, LpbckInptSrc &inptSrc, const uint16_t &ldQty, const unsigned long int &scansQty, TickType_t &lastWkTm);
+/* USER CODE END FP */
+
+/**
+  * @brief  The application entry point.
+  * @retval int
+  */
+int main(void)
+{
+  /* MCU Configuration--------------------------------------------------------*/
+
+  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
+  HAL_Init();
+
+  /* Configure the system clock */
+  SystemClock_Config();
+
+  /* Initialize all configured peripherals */
+  MX_GPIO_Init();
+
+  /* Create the thread(s) */
+  /* USER CODE BEGIN RTOS_THREADS */
+  xReturned = xTaskCreate(
+		  mainCtrlTsk, //taskFunction
+		  "MainControlTask", //Task function legible name
+		  512, // Stack depth in words
+		  NULL,	//Parameters to pass as arguments to the taskFunction
+		  configTIMER_TASK_PRIORITY,	//Set to the same priority level as the software timers
+		  &mainCtrlTskHndl);
+  if(xReturned != pdPASS)
+	  Error_Handler();
+/* USER CODE END RTOS_THREADS */
+
+  /* Start scheduler */
+  vTaskStartScheduler();
+
+  /* We should never get here as control is now taken by the scheduler */
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+/* USER CODE BEGIN */
+void mainCtrlTsk(void *pvParameters)
+{
+	DbncdMPBttn* tstBttns[tstInptsQty]{};
+	LpbckInptSrc tstInptSrc(tstInptsQty);
+	MPBttnPollGrp tstPollGrp("LtncyGrp");
+	MpbPollLaneLtncy_t laneLtncy{};
+	TickType_t lastWkTm{};
+
+	//The inputs are pulled up, a pressed NO MPB reads as a low level
+	for(uint16_t inptId{0}; inptId < tstInptsQty; ++inptId){
+		tstInptSrc.setInptLvl(inptId, true);
+		tstBttns[inptId] = new DbncdMPBttn(NULL, _InvalidPinNum, true, true, tstDbncTime);
+		if(!tstBttns[inptId]->setInptSrc(&tstInptSrc, inptId))
+			tstRslt = false;
+		tstPollGrp.addMPBttn(tstBttns[inptId], (inptId == tstPrtyInptId)?tstPrtyLane:0);
+	}
+
+	lastWkTm = xTaskGetTickCount();
+	for(uint8_t ldLvl{0}; ldLvl < tstLdLvlsQty; ++ldLvl){
+		tstPollGrp.resetLanesLtncy();
+		for(unsigned long int prssCcl{0}; prssCcl < tstPrssCclsQty; ++prssCcl){
+			tstInptSrc.setInptLvl(tstPrtyInptId, false);	//Press
+			tstInptSrc.setInptLvl(tstOrdnrInptId, false);
+			tstScans(tstPollGrp, tstInptSrc, tstLdLvls[ldLvl], (tstDbncTime / tstScanPrd) + 3, lastWkTm);
+			if(!tstBttns[tstPrtyInptId]->getIsOn() || !tstBttns[tstOrdnrInptId]->getIsOn())
+				tstRslt = false;
+
+			tstInptSrc.setInptLvl(tstPrtyInptId, true);	//Release
+			tstInptSrc.setInptLvl(tstOrdnrInptId, true);
+			tstScans(tstPollGrp, tstInptSrc, tstLdLvls[ldLvl], (tstDbncTime / tstScanPrd) + 3, lastWkTm);
+			if(tstBttns[tstPrtyInptId]->getIsOn() || tstBttns[tstOrdnrInptId]->getIsOn())
+				tstRslt = false;
+		}
+		laneLtncy = tstPollGrp.getLaneLtncy(tstPrtyLane);
+		bnchmrkRslts[ldLvl].prssLtncyMaxUs[0] = laneLtncy.prssLtncyMaxUs;
+		bnchmrkRslts[ldLvl].scanPosMaxUs[0] = laneLtncy.scanPosMaxUs;
+		if((laneLtncy.prssCnt != tstPrssCclsQty) || (laneLtncy.prssLtncyMaxUs > tstPrtyLtncyBoundUs))
+			tstRslt = false;
+		laneLtncy = tstPollGrp.getLaneLtncy(0);
+		bnchmrkRslts[ldLvl].prssLtncyMaxUs[1] = laneLtncy.prssLtncyMaxUs;
+		bnchmrkRslts[ldLvl].scanPosMaxUs[1] = laneLtncy.scanPosMaxUs;
+	}
+
+	if(tstRslt)
+		HAL_GPIO_WritePin(tstLedOnBoard.portId, tstLedOnBoard.pinNum, GPIO_PIN_SET);
+
+	for(;;)
+	{
+		vTaskDelay(1000);
+	}
+}
+
+void tstScans(MPBttnPollGrp &pollGrp, LpbckInptSrc &inptSrc, const uint16_t &ldQty, const unsigned long int &scansQty, TickType_t &lastWkTm){
+	//The load objects inputs toggle every scan, they keep bouncing and never become dormant
+	for(unsigned long int scanNum{0}; scanNum < scansQty; ++scanNum){
+		for(uint16_t inptId{tstLdFrstInptId}; inptId < (tstLdFrstInptId + ldQty); ++inptId)
+			inptSrc.setInptLvl(inptId, (scanNum % 2) == 0);
+		vTaskDelayUntil(&lastWkTm, tstScanPrd);
+		pollGrp.scanMPBttns();
+	}
+	for(uint16_t inptId{tstLdFrstInptId}; inptId < (tstLdFrstInptId + ldQty); ++inptId)
+		inptSrc.setInptLvl(inptId, true);
+
+	return;
+}
+/* USER CODE END */
+
+
+/**
+  * @brief System Clock Configuration
+  * @retval None
+  */
+void SystemClock_Config(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+  /** Configure the main internal regulator output voltage
+  */
+  __HAL_RCC_PWR_CLK_ENABLE();
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+  /** Initializes the RCC Oscillators according to the specified parameters
+  * in the RCC_OscInitTypeDef structure.
+  */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+  RCC_OscInitStruct.HSIState = RCC_HSI_ON;
+  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+  RCC_OscInitStruct.PLL.PLLM = 16;
+  RCC_OscInitStruct.PLL.PLLN = 336;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV4;
+  RCC_OscInitStruct.PLL.PLLQ = 4;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Initializes the CPU, AHB and APB buses clocks
+  */
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV2;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief GPIO Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_GPIO_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  /* GPIO Ports Clock Enable */
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  __HAL_RCC_GPIOH_CLK_ENABLE();
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+
+  /*Configure GPIO pin Output Level for tstLedOnBoard*/
+  HAL_GPIO_WritePin(tstLedOnBoard.portId, tstLedOnBoard.pinNum, GPIO_PIN_RESET);
+
+  /*Configure GPIO pin : tstLedOnBoard_Pin */
+  GPIO_InitStruct.Pin = tstLedOnBoard.pinNum;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(tstLedOnBoard.portId, &GPIO_InitStruct);
+}
+
+/**
+  * @brief  Period elapsed callback in non blocking mode
+  * @note   This function is called  when TIM9 interrupt took place, inside
+  * HAL_TIM_IRQHandler(). It makes a direct call to HAL_IncTick() to increment
+  * a global variable "uwTick" used as application time base.
+  * @param  htim : TIM handle
+  * @retval None
+  */
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+  if (htim->Instance == TIM9) {
+    HAL_IncTick();
+  }
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @retval None
+  */
+void Error_Handler(void)
+{
+  /* USER CODE BEGIN Error_Handler_Debug */
+  /* User can add his own implementation to report the HAL error return state */
+  __disable_irq();
+  while (1)
+  {
+  }
+  /* USER CODE END Error_Handler_Debug */
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t *file, uint32_t line)
+{
+  /* USER CODE BEGIN 6 */
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+  /* USER CODE END 6 */
+}
+#endif /* USE_FULL_ASSERT */
@@ -0,0 +1,293 @@
+/**
+  ******************************************************************************
+  * @file	: 15_MPBttnInptSrc_1d.cpp
+  * @brief  : Example for the ButtonToSwitch for STM32 library input sources
+  *
+  * The example exercises MPB objects sharing an analog line through a resistor
+  * ladder using:
+  * 	- An AdcLddrInptSrc object with 5 voltage windows, fed by the task with
+  * 	simulated conversions batches in place of the ADC DMA transfers
+  * 	- 5 DbncdMPBttn objects attached to the windows, serviced by a
+  * 	MPBttnPollGrp object
+  * 	- The Nucleo board user LED attached to GPIO_A05 to signal the result
+  *
+  * ### This example creates one Task:
+  *
+  * The task instantiates the MPB objects with no valid pin, attaches each one to
+  * a window and registers them in a MPBttnPollGrp object. Then it feeds noisy
+  * batches for each ladder MPB in turn, checking only the corresponding MPB
+  * turns On, and batches hovering over a window limit, checking the hysteresis
+  * band keeps the pressed MPB On.
+  * Replacing the feedSmplsBtch() invocations by the begin() invocation, with an
+  * ADC configured for continuous conversions with a circular DMA, is all that's
+  * needed to get the MPBs inputs from a real ladder.
+  *
+  * 	@author	: Gabriel D. Goldman
+  *
+  * 	@date	: 	01/01/2024 First release
+  * 				07/07/2024 Last update
+  *
+  ******************************************************************************
+  * @attention	This file is part of the Examples folder for the ButtonToSwitch for STM32
+  * library. All files needed are provided as part of the source code for the library.
+  *
+  ******************************************************************************
+  */
+//----------------------- BEGIN Specific to use STM32F4xxyy testing platform
+#define MCU_SPEC
+//======================> Replace the following two lines with the files corresponding with the used STM32 configuration files
+#include "stm32f4xx_hal.h"
+#include "stm32f4xx_hal_gpio.h"
+//----------------------- End Specific to use STM32F4xxyy testing platform
+
+/* Private includes ----------------------------------------------------------*/
+//===========================>> Next lines used to avoid CMSIS wrappers
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+//===========================>> Previous lines used to avoid CMSIS wrappers
+/* USER CODE BEGIN Includes */
+#include "../../ButtonToSwitch_STM32/src/ButtonToSwitch_STM32.h"
+/* USER CODE END Includes */
+
+/* Private variables ---------------------------------------------------------*/
+/* USER CODE BEGIN PV */
+gpioPinId_t tstLedOnBoard{GPIOA, GPIO_PIN_5};	// Pin 0b 0000 0000 0010 0000
+
+const uint8_t tstLddrMpbsQty{5};
+const uint16_t tstLddrLvls[tstLddrMpbsQty]{200, 900, 1600, 2300, 3000};	// 12 bits ADC counts
+const uint16_t tstWndwHlfWdth{250};
+const uint16_t tstHyst{100};
+const uint16_t tstIdleLvl{4095};
+const uint8_t tstBtchLen{16};
+const unsigned long int tstDbncTime{20};
+const unsigned long int tstScanDelay{10};
+
+bool tstRslt{true};
+
+TaskHandle_t mainCtrlTskHndl {NULL};
+BaseType_t xReturned;
+/* USER CODE END PV */
+
+/* Private function prototypes -----------------------------------------------*/
+void SystemClock_Config(void);
+static void MX_GPIO_Init(void);
+void Error_Handler(void);
+
+/* USER CODE BEGIN FP */
+void feedLvl(AdcLddrInptSrc &lddr, MPBttnPollGrp &pollGrp, const uint16_t &lvl);
+void mainCtrlTsk(void *pvParameters);
+/* USER CODE END FP */
+
+/**
+  * @brief  The application entry point.
+  * @retval int
+  */
+int main(void)
+{
+  /* MCU Configuration--------------------------------------------------------*/
+
+  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
+  HAL_Init();
+
+  /* Configure the system clock */
+  SystemClock_Config();
+
+  /* Initialize all configured peripherals */
+  MX_GPIO_Init();
+
+  /* Create the thread(s) */
+  /* USER CODE BEGIN RTOS_THREADS */
+  xReturned = xTaskCreate(
+		  mainCtrlTsk, //taskFunction
+		  "MainControlTask", //Task function legible name
+		  512, // Stack depth in words
+		  NULL,	//Parameters to pass as arguments to the taskFunction
+		  configTIMER_TASK_PRIORITY,	//Set to the same priority level as the software timers
+		  &mainCtrlTskHndl);
+  if(xReturned != pdPASS)
+	  Error_Handler();
+/* USER CODE END RTOS_THREADS */
+
+  /* Start scheduler */
+  vTaskStartScheduler();
+
+  /* We should never get here as control is now taken by the scheduler */
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+/* USER CODE BEGIN */
+void feedLvl(AdcLddrInptSrc &lddr, MPBttnPollGrp &pollGrp, const uint16_t &lvl)
+{
+	uint16_t smplsBtch[tstBtchLen]{};
+
+	for(unsigned long int scanNum{0}; scanNum <= (tstDbncTime / tstScanDelay) + 1; ++scanNum){
+		for(uint8_t smplNum{0}; smplNum < tstBtchLen; ++smplNum)
+			smplsBtch[smplNum] = lvl + (smplNum % 5) * 8 - 16;	//Conversions noise
+		lddr.feedSmplsBtch(smplsBtch, tstBtchLen);
+		pollGrp.scanMPBttns();
+		vTaskDelay(tstScanDelay);
+	}
+
+	return;
+}
+
+void mainCtrlTsk(void *pvParameters)
+{
+	DbncdMPBttn* tstBttns[tstLddrMpbsQty]{};
+	AdcLddrInptSrc tstLddr(NULL, tstBtchLen);
+	MPBttnPollGrp tstPollGrp("LddrGrp");
+
+	tstLddr.setHyst(tstHyst);
+	for(uint8_t wndw{0}; wndw < tstLddrMpbsQty; ++wndw){
+		if(!tstLddr.addWndw(tstLddrLvls[wndw] - tstWndwHlfWdth, tstLddrLvls[wndw] + tstWndwHlfWdth))
+			tstRslt = false;
+		tstBttns[wndw] = new DbncdMPBttn(NULL, _InvalidPinNum, true, true, tstDbncTime);
+		if(!tstBttns[wndw]->setInptSrc(&tstLddr, wndw))
+			tstRslt = false;
+		tstPollGrp.addMPBttn(tstBttns[wndw]);
+	}
+
+	for(uint8_t wndw{0}; wndw < tstLddrMpbsQty; ++wndw){
+		feedLvl(tstLddr, tstPollGrp, tstLddrLvls[wndw]);	//Press
+		for(uint8_t chkWndw{0}; chkWndw < tstLddrMpbsQty; ++chkWndw)
+			if(tstBttns[chkWndw]->getIsOn() != (chkWndw == wndw))
+				tstRslt = false;
+		feedLvl(tstLddr, tstPollGrp, tstLddrLvls[wndw] + tstWndwHlfWdth + (tstHyst / 2));	//Hovering over the window high limit
+		if(!tstBttns[wndw]->getIsOn())
+			tstRslt = false;
+		feedLvl(tstLddr, tstPollGrp, tstIdleLvl);	//Release
+		if(tstBttns[wndw]->getIsOn())
+			tstRslt = false;
+	}
+
+	if(tstRslt)
+		HAL_GPIO_WritePin(tstLedOnBoard.portId, tstLedOnBoard.pinNum, GPIO_PIN_SET);
+
+	for(;;)
+	{
+		vTaskDelay(1000);
+	}
+}
+/* USER CODE END */
+
+
+/**
+  * @brief System Clock Configuration
+  * @retval None
+  */
+void SystemClock_Config(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+  /** Configure the main internal regulator output voltage
+  */
+  __HAL_RCC_PWR_CLK_ENABLE();
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+  /** Initializes the RCC Oscillators according to the specified parameters
+  * in the RCC_OscInitTypeDef structure.
+  */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+  RCC_OscInitStruct.HSIState = RCC_HSI_ON;
+  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+  RCC_OscInitStruct.PLL.PLLM = 16;
+  RCC_OscInitStruct.PLL.PLLN = 336;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV4;
+  RCC_OscInitStruct.PLL.PLLQ = 4;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Initializes the CPU, AHB and APB buses clocks
+  */
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV2;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief GPIO Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_GPIO_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  /* GPIO Ports Clock Enable */
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  __HAL_RCC_GPIOH_CLK_ENABLE();
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+
+  /*Configure GPIO pin Output Level for tstLedOnBoard*/
+  HAL_GPIO_WritePin(tstLedOnBoard.portId, tstLedOnBoard.pinNum, GPIO_PIN_RESET);
+
+  /*Configure GPIO pin : tstLedOnBoard_Pin */
+  GPIO_InitStruct.Pin = tstLedOnBoard.pinNum;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(tstLedOnBoard.portId, &GPIO_InitStruct);
+}
+
+/**
+  * @brief  Period elapsed callback in non blocking mode
+  * @note   This function is called  when TIM9 interrupt took place, inside
+  * HAL_TIM_IRQHandler(). It makes a direct call to HAL_IncTick() to increment
+  * a global variable "uwTick" used as application time base.
+  * @param  htim : TIM handle
+  * @retval None
+  */
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+  if (htim->Instance == TIM9) {
+    HAL_IncTick();
+  }
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @retval None
+  */
+void Error_Handler(void)
+{
+  /* USER CODE BEGIN Error_Handler_Debug */
+  /* User can add his own implementation to report the HAL error return state */
+  __disable_irq();
+  while (1)
+  {
+  }
+  /* USER CODE END Error_Handler_Debug */
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t *file, uint32_t line)
+{
+  /* USER CODE BEGIN 6 */
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+  /* USER CODE END 6 */
+}
+#endif /* USE_FULL_ASSERT */
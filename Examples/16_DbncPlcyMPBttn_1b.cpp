@@ -0,0 +1,314 @@
+/**
+  ******************************************************************************
+  * @file	: 16_DbncPlcyMPBttn_1b.cpp
+  * @brief  : Example for the ButtonToSwitch for STM32 library debounce policies
+  *
+  * The example compares the press latency of the timestamp debounce scheme and
+  * the eager lock-out scheme using:
+  * 	- A LpbckInptSrc object feeding synthetic bounce traces to the MPBs
+  * 	- 3 DbncPlcyMPBttn objects: a TmStmpDbncPlcy one, a LckOutDbncPlcy one and
+  * 	a LckOutDbncPlcy one with glitch check, each serviced by it's own
+  * 	MPBttnPollGrp object
+  * 	- The Nucleo board user LED attached to GPIO_A05 to signal the end of the benchmark
+  *
+  * ### This example creates one Task:
+  *
+  * The task feeds the same synthetic traces to the three objects, one sample
+  * per millisecond: presses with pseudo random bounces of different lengths
+  * followed by a stable press and a stable release, and a noise spike of a
+  * single sample. For each object and trace the detection latency (the
+  * milliseconds from the first edge of the press to the object turning On) and
+  * the milliseconds the object was On during the noise spike trace are kept in
+  * the bnchmrkRslts array, to be inspected with the debugger once the user LED
+  * is turned on.
+  * The timestamp scheme object is set to the minimum 20 milliseconds debounce
+  * time, the lock-out scheme objects to a 20 samples lock-out window, the
+  * glitch check being done 2 samples after the change.
+  *
+  * 	@author	: Gabriel D. Goldman
+  *
+  * 	@date	: 	01/01/2024 First release
+  * 				07/07/2024 Last update
+  *
+  ******************************************************************************
+  * @attention	This file is part of the Examples folder for the ButtonToSwitch for STM32
+  * library. All files needed are provided as part of the source code for the library.
+  *
+  ******************************************************************************
+  */
+//----------------------- BEGIN Specific to use STM32F4xxyy testing platform
+#define MCU_SPEC
+//======================> Replace the following two lines with the files corresponding with the used STM32 configuration files
+#include "stm32f4xx_hal.h"
+#include "stm32f4xx_hal_gpio.h"
+//----------------------- End Specific to use STM32F4xxyy testing platform
+
+/* Private includes ----------------------------------------------------------*/
+//===========================>> Next lines used to avoid CMSIS wrappers
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+//===========================>> Previous lines used to avoid CMSIS wrappers
+/* USER CODE BEGIN Includes */
+#include "../../ButtonToSwitch_STM32/src/ButtonToSwitch_STM32.h"
+/* USER CODE END Includes */
+
+/* Private variables ---------------------------------------------------------*/
+/* USER CODE BEGIN PV */
+gpioPinId_t tstLedOnBoard{GPIOA, GPIO_PIN_5};	// Pin 0b 0000 0000 0010 0000
+
+const uint8_t plcsQty{3};	// [0]: TmStmpDbncPlcy, [1]: LckOutDbncPlcy, [2]: LckOutDbncPlcy with glitch check
+const uint8_t trcsQty{4};	// The last trace is the noise spike
+const unsigned long int trcsBncLen[trcsQty]{2, 5, 10, 1};	// Bounces length, in samples
+const unsigned long int trcStblLen{50};	// Stable level length, in samples
+
+struct bnchmrkRslt_t{
+	unsigned long int prssLtncyMs;
+	unsigned long int spkOnMs;
+};
+bnchmrkRslt_t bnchmrkRslts[plcsQty][trcsQty]{};
+
+TaskHandle_t mainCtrlTskHndl {NULL};
+BaseType_t xReturned;
+/* USER CODE END PV */
+
+/* Private function prototypes -----------------------------------------------*/
+void SystemClock_Config(void);
+static void MX_GPIO_Init(void);
+void Error_Handler(void);
+
+/* USER CODE BEGIN FP */
+void mainCtrlTsk(void *pvParameters);
+/* USER CODE END FP */
+
+/**
+  * @brief  The application entry point.
+  * @retval int
+  */
+int main(void)
+{
+  /* MCU Configuration--------------------------------------------------------*/
+
+  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
+  HAL_Init();
+
+  /* Configure the system clock */
+  SystemClock_Config();
+
+  /* Initialize all configured peripherals */
+  MX_GPIO_Init();
+
+  /* Create the thread(s) */
+  /* USER CODE BEGIN RTOS_THREADS */
+  xReturned = xTaskCreate(
+		  mainCtrlTsk, //taskFunction
+		  "MainControlTask", //Task function legible name
+		  1024, // Stack depth in words
+		  NULL,	//Parameters to pass as arguments to the taskFunction
+		  configTIMER_TASK_PRIORITY,	//Set to the same priority level as the software timers
+		  &mainCtrlTskHndl);
+  if(xReturned != pdPASS)
+	  Error_Handler();
+/* USER CODE END RTOS_THREADS */
+
+  /* Start scheduler */
+  vTaskStartScheduler();
+
+  /* We should never get here as control is now taken by the scheduler */
+  /* Infinite loop */
+  while (1)
+  {
+  }
+}
+/* USER CODE BEGIN */
+void mainCtrlTsk(void *pvParameters)
+{
+	LpbckInptSrc tstInptSrc(plcsQty);
+	DbncPlcyMPBttn<TmStmpDbncPlcy> tmStmpBttn(nullptr, _InvalidPinNum, true, true);
+	DbncPlcyMPBttn<LckOutDbncPlcy<20>> lckOutBttn(nullptr, _InvalidPinNum, true, true);
+	DbncPlcyMPBttn<LckOutDbncPlcy<20, 2>> lckOutGlchBttn(nullptr, _InvalidPinNum, true, true);
+	DbncdMPBttn* tstBttns[plcsQty]{&tmStmpBttn, &lckOutBttn, &lckOutGlchBttn};
+	MPBttnPollGrp* tstPollGrps[plcsQty]{};
+	unsigned long int frstEdge{0};
+	unsigned long int prssDtctd[plcsQty]{};
+	unsigned long int onSmpls[plcsQty]{};
+	unsigned long int trcLen{0};
+	uint32_t rndmSd{0x1234567};
+	bool smplLvl{true};
+	bool isSpk{false};
+
+	for(uint8_t plcy{0}; plcy < plcsQty; ++plcy){
+		tstInptSrc.setInptLvl(plcy, true);	//Pulled up input, released
+		tstBttns[plcy]->setInptSrc(&tstInptSrc, plcy);
+		tstPollGrps[plcy] = new MPBttnPollGrp("PlcyGrp");
+		tstPollGrps[plcy]->addMPBttn(tstBttns[plcy]);
+	}
+
+	for(uint8_t trc{0}; trc < trcsQty; ++trc){
+		isSpk = (trc == (trcsQty - 1));
+		trcLen = (isSpk)?trcStblLen:(trcsBncLen[trc] + 2 * trcStblLen);
+		frstEdge = 0;
+		for(uint8_t plcy{0}; plcy < plcsQty; ++plcy){
+			prssDtctd[plcy] = 0;
+			onSmpls[plcy] = 0;
+		}
+		//Bounced press, stable press, stable release. The noise spike is a single pressed sample
+		for(unsigned long int smplNum{0}; smplNum < trcLen; ++smplNum){
+			if(isSpk){
+				smplLvl = (smplNum != 0);
+			}
+			else if(smplNum < trcsBncLen[trc]){
+				rndmSd = rndmSd * 1103515245 + 12345;
+				smplLvl = (smplNum == 0)?false:(((rndmSd >> 16) & 0x01) != 0);	//The first edge is always a press
+			}
+			else{
+				smplLvl = (smplNum >= (trcsBncLen[trc] + trcStblLen));	//Pressed (low) until the stable release
+			}
+			for(uint8_t plcy{0}; plcy < plcsQty; ++plcy)
+				tstInptSrc.setInptLvl(plcy, smplLvl);
+			for(uint8_t plcy{0}; plcy < plcsQty; ++plcy){
+				tstPollGrps[plcy]->scanMPBttns();
+				if(tstBttns[plcy]->getIsOn()){
+					if(prssDtctd[plcy] == 0)
+						prssDtctd[plcy] = smplNum - frstEdge + 1;
+					++onSmpls[plcy];
+				}
+			}
+			vTaskDelay(1);
+		}
+		for(uint8_t plcy{0}; plcy < plcsQty; ++plcy){
+			if(isSpk){
+				bnchmrkRslts[plcy][trc].spkOnMs = onSmpls[plcy];
+			}
+			else{
+				bnchmrkRslts[plcy][trc].prssLtncyMs = (prssDtctd[plcy] > 0)?(prssDtctd[plcy] - 1):0;
+			}
+		}
+	}
+	HAL_GPIO_WritePin(tstLedOnBoard.portId, tstLedOnBoard.pinNum, GPIO_PIN_SET);
+
+	for(;;)
+	{
+		vTaskDelay(1000);
+	}
+}
+/* USER CODE END */
+
+
+/**
+  * @brief System Clock Configuration
+  * @retval None
+  */
+void SystemClock_Config(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+  /** Configure the main internal regulator output voltage
+  */
+  __HAL_RCC_PWR_CLK_ENABLE();
+  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+  /** Initializes the RCC Oscillators according to the specified parameters
+  * in the RCC_OscInitTypeDef structure.
+  */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+  RCC_OscInitStruct.HSIState = RCC_HSI_ON;
+  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+  RCC_OscInitStruct.PLL.PLLM = 16;
+  RCC_OscInitStruct.PLL.PLLN = 336;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV4;
+  RCC_OscInitStruct.PLL.PLLQ = 4;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Initializes the CPU, AHB and APB buses clocks
+  */
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV2;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief GPIO Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_GPIO_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  /* GPIO Ports Clock Enable */
+  __HAL_RCC_GPIOC_CLK_ENABLE();
+  __HAL_RCC_GPIOH_CLK_ENABLE();
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+
+  /*Configure GPIO pin Output Level for tstLedOnBoard*/
+  HAL_GPIO_WritePin(tstLedOnBoard.portId, tstLedOnBoard.pinNum, GPIO_PIN_RESET);
+
+  /*Configure GPIO pin : tstLedOnBoard_Pin */
+  GPIO_InitStruct.Pin = tstLedOnBoard.pinNum;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(tstLedOnBoard.portId, &GPIO_InitStruct);
+}
+
+/**
+  * @brief  Period elapsed callback in non blocking mode
+  * @note   This function is called  when TIM9 interrupt took place, inside
+  * HAL_TIM_IRQHandler(). It makes a direct call to HAL_IncTick() to increment
+  * a global variable "uwTick" used as application time base.
+  * @param  htim : TIM handle
+  * @retval None
+  */
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+  if (htim->Instance == TIM9) {
+    HAL_IncTick();
+  }
+}
+
+/**
+  * @brief  This function is executed in case of error occurrence.
+  * @retval None
+  */
+void Error_Handler(void)
+{
+  /* USER CODE BEGIN Error_Handler_Debug */
+  /* User can add his own implementation to report the HAL error return state */
+  __disable_irq();
+  while (1)
+  {
+  }
+  /* USER CODE END Error_Handler_Debug */
+}
+
+#ifdef  USE_FULL_ASSERT
+/**
+  * @brief  Reports the name of the source file and the source line number
+  *         where the assert_param error has occurred.
+  * @param  file: pointer to the source file name
+  * @param  line: assert_param error line source number
+  * @retval None
+  */
+void assert_failed(uint8_t *file, uint32_t line)
+{
+  /* USER CODE BEGIN 6 */
+  /* User can add his own implementation to report the file name and line number,
+     ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
+  /* USER CODE END 6 */
+}
+#endif /* USE_FULL_ASSERT */
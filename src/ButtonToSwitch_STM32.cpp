@@ -40,6 +40,9 @@ static BaseType_t errorFlag {pdFALSE};
 
 //=========================================================================> Class methods delimiter
 
+DbncdMPBttn* DbncdMPBttn::_cptrMpbLst[_cptrMpbLstLen] {nullptr};
+DbncdMPBttn* DbncdMPBttn::_extiMpbLst[16] {nullptr};
+
 DbncdMPBttn::DbncdMPBttn()
 :_mpbttnPort{NULL}, _mpbttnPin{0}, _pulledUp{true}, _typeNO{true}, _dbncTimeOrigSett{0}
 {
@@ -108,11 +111,6 @@ DbncdMPBttn::DbncdMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, co
 
 		_mpbPollTmrName = _mpbPollTmrName + mpbPinNumStr + "_tmr";
 
-		if(_dbncTimeOrigSett < _stdMinDbncTime) 	// Best practice would impose failing the constructor (throwing an exception or building a "zombie" object)
-			_dbncTimeOrigSett = _stdMinDbncTime;	//this tolerant approach taken for developers benefit, but object will be no faithful to the instantiation parameters
-		_dbncTimeTempSett = _dbncTimeOrigSett;
-		_dbncRlsTimeTempSett = _stdMinDbncTime;	//The Release debouncing time parameter is kept to the minimum empirical value
-
 		/*Configure GPIO pin : _mpbttnPin */
       GPIO_InitTypeDef GPIO_InitStruct {0};
 
@@ -121,11 +119,12 @@ DbncdMPBttn::DbncdMPBttn(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, co
 		GPIO_InitStruct.Pull = (_pulledUp == true)?GPIO_PULLUP:GPIO_PULLDOWN;
 		HAL_GPIO_Init(_mpbttnPort, &GPIO_InitStruct);
 	}
-	else{
-      _pulledUp = true;
-      _typeNO = true;
-      _dbncTimeOrigSett = 0;
-	}
+	//The debounce settings are applied even with no valid pin, as the input might be provided by an input source, see setInptSrc(MPBttnInptSrc*, const uint16_t&)
+	if(_dbncTimeOrigSett < _stdMinDbncTime) 	// Best practice would impose failing the constructor (throwing an exception or building a "zombie" object)
+		_dbncTimeOrigSett = _stdMinDbncTime;	//this tolerant approach taken for developers benefit, but object will be no faithful to the instantiation parameters
+	_dbncTimeTempSett = _dbncTimeOrigSett;
+	_dbncRlsTimeTempSett = _stdMinDbncTime;	//The Release debouncing time parameter is kept to the minimum empirical value
+	_setPrssdLvlInvMsk();
 }
 
 DbncdMPBttn::DbncdMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett)
@@ -135,8 +134,22 @@ DbncdMPBttn::DbncdMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const
 
 DbncdMPBttn::~DbncdMPBttn() {
 
+	// Release the timer capture channel
+	if(_cptrTimHndl != NULL)
+		setHwFltr(NULL, 0, 0, 0);
 	// Stop the refreshing timer:
 	end();
+	// Release the EXTI line, the GPIO de-initialization disables the line interrupt
+	if(_extiTrgrd){
+		taskENTER_CRITICAL();
+		_extiMpbLst[singleBitPosNum(_mpbttnPin)] = nullptr;
+		_extiTrgrd = false;
+		_edgeTrgrd = false;
+		taskEXIT_CRITICAL();
+	}
+	// Detach from the poll group servicing the object, if any:
+	if(_mpbPollGrp != nullptr)
+		_mpbPollGrp->rmvMPBttn(this);
 	// De-initialize the GPIOx peripheral registers to their default reset values
 	HAL_GPIO_DeInit(_mpbttnPort, _mpbttnPin);
 	// Disable the GPIOx_CLK:
@@ -145,20 +158,64 @@ DbncdMPBttn::~DbncdMPBttn() {
 
 }
 
+void DbncdMPBttn::_bncTrnDtct(const uint8_t &trnIdx, const unsigned long int &dtctTm, const unsigned long int &maxGap){
+	BncTrnStt_t &bncTrn {_bncTrns[trnIdx]};
+
+	//A detection interrupted for longer than the debounce time was a glitch, the bounce train is started again
+	if((bncTrn.strtTm == 0) || (bncTrn.intrTm == 0) || ((dtctTm - bncTrn.intrTm) > maxGap)){
+		bncTrn.strtTm = dtctTm;
+		bncTrn.trnstnsQty = 1;
+	}
+	else{
+		bncTrn.trnstnsQty += 2;	//The level was lost and detected again
+	}
+	bncTrn.intrTm = 0;
+
+	return;
+}
+
+void DbncdMPBttn::_bncTrnIntr(const uint8_t &trnIdx, const unsigned long int &intrTm){
+	if(_bncTrns[trnIdx].strtTm != 0)
+		_bncTrns[trnIdx].intrTm = intrTm;
+
+	return;
+}
+
+void DbncdMPBttn::_bncTrnVldt(const uint8_t &trnIdx, const unsigned long int &stblStrtTm){
+	BncTrnStt_t &bncTrn {_bncTrns[trnIdx]};
+
+	if(bncTrn.strtTm != 0){
+		bncTrn.lastTrn.bncTm = stblStrtTm - bncTrn.strtTm;
+		bncTrn.lastTrn.trnstnsQty = bncTrn.trnstnsQty;
+		bncTrn.strtTm = 0;
+		bncTrn.intrTm = 0;
+		if(_dbncLrn)
+			_dbncLrnUpd(bncTrn.lastTrn.bncTm);
+		_chttrSttsUpd(bncTrn.lastTrn);
+	}
+
+	return;
+}
+
 bool DbncdMPBttn::begin(const unsigned long int &pollDelayMs) {
     bool result {false};
     BaseType_t tmrModResult {pdFAIL};
 
-    if (pollDelayMs > 0){
+    if ((pollDelayMs > 0) && (_mpbPollGrp == nullptr)){
         if (!_mpbPollTmrHndl){
+        	_pollDelay = pollDelayMs;
+        	_curPollDelay = (_adptvPoll)?_fastPollDelay:_pollDelay;
             _mpbPollTmrHndl = xTimerCreate(
             		_mpbPollTmrName.c_str(),  //Timer name
-                pdMS_TO_TICKS(pollDelayMs),  //Timer period in ticks by conversion from milliseconds
+                pdMS_TO_TICKS(_curPollDelay),  //Timer period in ticks by conversion from milliseconds
                 pdTRUE,     //Auto-reload true
                 this,       //TimerID: data passed to the callback function to work
                 mpbPollCallback	  //Callback function
 				);
             if (_mpbPollTmrHndl != NULL){
+            	_pollPsd = false;
+            	_extiPollActv = true;	//In EXTI triggered mode the first polling rounds settle the current input state
+            	resetPollsCnt();
                tmrModResult = xTimerStart(_mpbPollTmrHndl, portMAX_DELAY);
             	if (tmrModResult == pdPASS)
                   result = true;
@@ -169,6 +226,29 @@ bool DbncdMPBttn::begin(const unsigned long int &pollDelayMs) {
     return result;
 }
 
+void DbncdMPBttn::_chttrSttsUpd(const MpbBncTrn_t &bncTrn){
+	unsigned long int bncTm {(bncTrn.bncTm > 0xFFFF)?0xFFFF:bncTrn.bncTm};
+
+	if(_bncTrnsCnt == 0)
+		_bncTmAvg = bncTm << 8;
+	else
+		_bncTmAvg = _bncTmAvg - (_bncTmAvg >> _bncTmAvgShft) + ((bncTm << 8) >> _bncTmAvgShft);
+	if(bncTm > _bncTmMax)
+		_bncTmMax = bncTm;
+	++_bncTrnsCnt;
+	_bncTrnstnsCnt += bncTrn.trnstnsQty;
+	if(bncTrn.trnstnsQty > 1)
+		++_chttrTrnsCnt;
+
+	if(!_cntctDgrdd && (_cntctDgrdThrshld > 0) && (_bncTmAvg > (_cntctDgrdThrshld << 8))){
+		_cntctDgrdd = true;
+		if(_fnWhnCntctDgrdd != nullptr)
+			_fnWhnCntctDgrdd();
+	}
+
+	return;
+}
+
 void DbncdMPBttn::clrStatus(bool clrIsOn){
 	/*To Resume operations after a pause() without risking generating false "Valid presses" and "On" situations,
 	several attributes must be reseted to "Start" values
@@ -196,6 +276,44 @@ void DbncdMPBttn::clrSttChng(){
 	return;
 }
 
+void DbncdMPBttn::_dbncLrnUpd(const unsigned long int &bncTm){
+	uint16_t srtdSmpls[_dbncLrnSmplsQty]{};
+	uint16_t smpl{0};
+	uint8_t smplPos{0};
+	unsigned long int lrndDbncTime{0};
+	unsigned long int lrnMrgn{_dbncLrnMrgn};
+	unsigned long int pollDelay{(_mpbPollGrp != nullptr)?_mpbPollGrp->getPollDelay():((_adptvPoll)?_fastPollDelay:_pollDelay)};
+
+	_dbncLrnSmpls[_dbncLrnSmplsIdx] = (bncTm > 0xFFFF)?0xFFFF:bncTm;
+	_dbncLrnSmplsIdx = (_dbncLrnSmplsIdx + 1) % _dbncLrnSmplsQty;
+	if(_dbncLrnSmplsCnt < _dbncLrnSmplsQty)
+		++_dbncLrnSmplsCnt;
+
+	if(_dbncLrnSmplsCnt >= _dbncLrnMinSmpls){
+		//Insertion sort, the buffer is short enough to be sorted every time with no noticeable cost
+		for(uint8_t smplNum{0}; smplNum < _dbncLrnSmplsCnt; ++smplNum){
+			smpl = _dbncLrnSmpls[smplNum];
+			smplPos = smplNum;
+			while((smplPos > 0) && (srtdSmpls[smplPos - 1] > smpl)){
+				srtdSmpls[smplPos] = srtdSmpls[smplPos - 1];
+				--smplPos;
+			}
+			srtdSmpls[smplPos] = smpl;
+		}
+		//The bounce times are measured with the polling delay resolution, the margin must cover it
+		if(lrnMrgn < pollDelay)
+			lrnMrgn = pollDelay;
+		lrndDbncTime = srtdSmpls[((_dbncLrnSmplsCnt - 1) * _dbncLrnPrcntl) / 100] + lrnMrgn;
+		if(lrndDbncTime < _dbncLrnMin)
+			lrndDbncTime = _dbncLrnMin;
+		else if(lrndDbncTime > _dbncLrnMax)
+			lrndDbncTime = _dbncLrnMax;
+		_dbncTimeTempSett = lrndDbncTime;
+	}
+
+	return;
+}
+
 void DbncdMPBttn::disable(){
 
     return _setIsEnabled(false);
@@ -231,6 +349,50 @@ const unsigned long int DbncdMPBttn::getCurDbncTime() const{
 	return _dbncTimeTempSett;
 }
 
+const unsigned long int DbncdMPBttn::getCurPollDelay() const{
+
+	return _curPollDelay;
+}
+
+const bool DbncdMPBttn::getDbncLrn() const{
+
+	return _dbncLrn;
+}
+
+const MpbChttrStts_t DbncdMPBttn::getChttrStts() const{
+	MpbChttrStts_t result{};
+
+	taskENTER_CRITICAL();
+	result.bncTrnsCnt = _bncTrnsCnt;
+	result.chttrTrnsCnt = _chttrTrnsCnt;
+	result.trnstnsCnt = _bncTrnstnsCnt;
+	result.bncTmAvgUs = ((_bncTmAvg >> 8) * 1000) + (((_bncTmAvg & 0xFF) * 1000) >> 8);
+	result.bncTmMaxMs = _bncTmMax;
+	taskEXIT_CRITICAL();
+
+	return result;
+}
+
+const bool DbncdMPBttn::getCntctDgrdd() const{
+
+	return _cntctDgrdd;
+}
+
+const bool DbncdMPBttn::getExtiTrgrd() const{
+
+	return _extiTrgrd;
+}
+
+const bool DbncdMPBttn::getAdptvPoll() const{
+
+	return _adptvPoll;
+}
+
+fncPtrType DbncdMPBttn::getFnWhnCntctDgrdd(){
+
+	return _fnWhnCntctDgrdd;
+}
+
 fncPtrType DbncdMPBttn::getFnWhnTrnOff(){
 
 	return _fnWhnTrnOff;
@@ -241,6 +403,16 @@ fncPtrType DbncdMPBttn::getFnWhnTrnOn(){
 	return _fnWhnTrnOn;
 }
 
+uint32_t DbncdMPBttn::_edgeTmStmp(const unsigned long int &edgeTm){
+	//The captured edge time is the time of the last edge, the one starting the level being validated
+	return (_cptrUsTmStmp)?_xtrnPinLvlTmUs:(uint32_t)(edgeTm * 1000);
+}
+
+const unsigned long int DbncdMPBttn::getHwFltrTmNs() const{
+
+	return _hwFltrTmNs;
+}
+
 const bool DbncdMPBttn::getIsEnabled() const{
 
     return _isEnabled;
@@ -256,6 +428,67 @@ const bool DbncdMPBttn::getIsOnDisabled() const{
     return _isOnDisabled;
 }
 
+const MpbBncTrn_t DbncdMPBttn::getLastPrssBncTrn() const{
+
+	return _bncTrns[0].lastTrn;
+}
+
+const uint32_t DbncdMPBttn::getLastPrssTmStmp() const{
+
+	return _lastPrssTmStmp;
+}
+
+const uint32_t DbncdMPBttn::getLastRlsTmStmp() const{
+
+	return _lastRlsTmStmp;
+}
+
+const MpbBncTrn_t DbncdMPBttn::getLastRlsBncTrn() const{
+
+	return _bncTrns[1].lastTrn;
+}
+
+MPBttnPollGrp* DbncdMPBttn::getMPBttnPollGrp() const{
+
+	return _mpbPollGrp;
+}
+
+const unsigned long int DbncdMPBttn::getMinOnTm() const{
+
+	return _minOnTm;
+}
+
+const unsigned long int DbncdMPBttn::getNxtDdln() const{
+	unsigned long int result {0};
+	unsigned long int strtchDdln {0};
+
+	if(_isPressed && !_prssRlsCcl && (_dbncTimerStrt != 0))
+		result = _dbncTimerStrt + ((_xtrnDbncd || _plcyDbncd)?0:_dbncTimeTempSett) + _strtDelay;	//Press debounce and delay end
+	else if(!_isPressed && _prssRlsCcl && (_dbncRlsTimerStrt != 0))
+		result = _dbncRlsTimerStrt + ((_xtrnDbncd || _plcyDbncd)?0:_dbncRlsTimeTempSett);	//Release debounce end
+	if((_mpbFdaState == stOnVRP) && _isOn && (_minOnTm > 0)){
+		strtchDdln = _onTmStrt + _minOnTm;	//On pulse stretching end
+		if((result == 0) || (strtchDdln < result))
+			result = strtchDdln;
+	}
+
+	return result;
+}
+
+const long int DbncdMPBttn::getPollsAvdd() const{
+	long int result {0};
+
+	if(_pollDelay > 0)
+		result = static_cast<long int>(((xTaskGetTickCount() / portTICK_RATE_MS) - _pollsCntStrt) / _pollDelay) - static_cast<long int>(_pollsCnt);
+
+	return result;
+}
+
+const unsigned long int DbncdMPBttn::getPollsCnt() const{
+
+	return _pollsCnt;
+}
+
 const bool DbncdMPBttn::getIsPressed() const {
 
 	return _isPressed;
@@ -286,6 +519,18 @@ const TaskHandle_t DbncdMPBttn::getTaskWhileOn(){
 	return _taskWhileOnHndl;
 }
 
+bool DbncdMPBttn::_isStbl(){
+	/*The object is considered stable when no debounce process is in progress (the pressed status matches the press-release cycle status),
+	no state machine transition is pending to be processed, and no valid event flag is waiting to be consumed by the state machine*/
+
+	return (!_sttChng && (_isPressed == _prssRlsCcl) && !_validPressPend && !_validReleasePend && !_validEnablePend && !_validDisablePend);
+}
+
+bool DbncdMPBttn::_isTmdSttPend(){
+
+	return ((_mpbFdaState == stOnVRP) && _isOn && (_minOnTm > 0));	//The On pulse is being stretched
+}
+
 bool DbncdMPBttn::init(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett){
     bool result {false};
 
@@ -294,6 +539,7 @@ bool DbncdMPBttn::init(GPIO_TypeDef* mpbttnPort, const uint16_t &mpbttnPin, cons
 		_pulledUp = pulledUp;
 		_typeNO = typeNO;
 		_dbncTimeOrigSett = dbncTimeOrigSett;
+		_setPrssdLvlInvMsk();
 
       std::string mpbPollTmrName{ "PollMpbPin" };
       std::string mpbPinNumStr{ "00" + std::to_string(singleBitPosNum(_mpbttnPin)) };
@@ -376,32 +622,134 @@ bool DbncdMPBttn::init(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const b
 	return init(mpbttnPinStrct.portId, mpbttnPinStrct.pinNum, pulledUp, typeNO, dbncTimeOrigSett);
 }
 
+void DbncdMPBttn::mpbCptrCallback(TIM_HandleTypeDef* htim){
+	DbncdMPBttn* mpbObj {nullptr};
+	BaseType_t xHigherPriorityTaskWoken {pdFALSE};
+
+	for(uint8_t lstSlot{0}; lstSlot < _cptrMpbLstLen; ++lstSlot){
+		mpbObj = _cptrMpbLst[lstSlot];
+		if((mpbObj != nullptr) && (mpbObj->_cptrTimHndl == htim) && (mpbObj->_cptrActvChnl == htim->Channel)){
+			/*The channel captures both edges of the filtered input, so each capture toggles the level, synchronized with the pin when the filter was set.
+			The raw pin is not read, as it might be bouncing again when the ISR is executed*/
+			mpbObj->_xtrnPinLvl = !mpbObj->_xtrnPinLvl;
+			mpbObj->_xtrnPinLvlTm = xTaskGetTickCountFromISR() / portTICK_RATE_MS;
+			if(mpbObj->_cptrUsTmStmp)
+				mpbObj->_xtrnPinLvlTmUs = HAL_TIM_ReadCapturedValue(htim, mpbObj->_cptrTimChnl);	//The free running 1 MHz counter value is the timestamp
+			mpbObj->_xtrnPinLvlChng = true;
+			_edgeWkpFromISR(mpbObj, &xHigherPriorityTaskWoken);
+		}
+	}
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+
+	return;
+}
+
+void DbncdMPBttn::_edgeWkpFromISR(DbncdMPBttn* mpbObj, BaseType_t* pxHigherPriorityTaskWoken){
+	unsigned long int nxtPollDelay {0};
+
+	if((mpbObj != nullptr) && (mpbObj->_mpbPollTmrHndl != NULL) && !mpbObj->_pollPsd){
+		mpbObj->_extiEdgePend = true;
+		nxtPollDelay = (mpbObj->_adptvPoll)?mpbObj->_fastPollDelay:mpbObj->_pollDelay;
+		if(nxtPollDelay != mpbObj->_curPollDelay){	//The timer is stopped or waiting for a deadline, the changed period (re)starts it
+			if(xTimerChangePeriodFromISR(mpbObj->_mpbPollTmrHndl, pdMS_TO_TICKS(nxtPollDelay), pxHigherPriorityTaskWoken) == pdPASS){
+				mpbObj->_curPollDelay = nxtPollDelay;
+				mpbObj->_extiPollActv = true;
+			}
+		}
+		else if(!mpbObj->_extiPollActv){
+			if(xTimerStartFromISR(mpbObj->_mpbPollTmrHndl, pxHigherPriorityTaskWoken) == pdPASS)
+				mpbObj->_extiPollActv = true;
+		}
+	}
+
+	return;
+}
+
+void DbncdMPBttn::mpbExtiCallback(uint16_t GPIO_Pin){
+	uint8_t extiLine {singleBitPosNum(GPIO_Pin)};
+	BaseType_t xHigherPriorityTaskWoken {pdFALSE};
+
+	if(extiLine < 16)
+		_edgeWkpFromISR(_extiMpbLst[extiLine], &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+
+	return;
+}
+
 void DbncdMPBttn::mpbPollCallback(TimerHandle_t mpbTmrCbArg){
 	DbncdMPBttn* mpbObj = (DbncdMPBttn*)pvTimerGetTimerID(mpbTmrCbArg);
+	bool isStbl {false};
+	bool tmrStppd {false};
+	unsigned long int curTm {0};
+	unsigned long int nxtDdln {0};
+	unsigned long int nxtPollDelay {0};
+
+	if(mpbObj->_edgeTrgrd)
+		mpbObj->_extiEdgePend = false;	//Edges detected from this point on will keep the timer running
+	if(mpbObj->_inptSrc != nullptr)
+		mpbObj->_inptSrc->rfrsh();	//The input source transfer can't be executed in the critical section of the update
+	mpbObj->mpbPollUpd();
+	++(mpbObj->_pollsCnt);
+
+	taskENTER_CRITICAL();
+	isStbl = mpbObj->_isStbl();
+	if(mpbObj->_edgeTrgrd && !mpbObj->_extiEdgePend && isStbl && !mpbObj->_isTmdSttPend()){
+		//Nothing left to be solved by polling, the timer waits for the next EXTI edge
+		xTimerStop(mpbTmrCbArg, 0);
+		mpbObj->_extiPollActv = false;
+		tmrStppd = true;
+	}
+	taskEXIT_CRITICAL();
+
+	if(!tmrStppd && (mpbObj->_adptvPoll || mpbObj->_edgeTrgrd)){
+		nxtPollDelay = (mpbObj->_adptvPoll)?((isStbl)?mpbObj->_slowPollDelay:mpbObj->_fastPollDelay):mpbObj->_pollDelay;
+		if(isStbl && !mpbObj->_extiEdgePend){
+			/*Only timed matters are pending: the next poll is scheduled for the next deadline if it comes before the next regular poll,
+			 or always for EXTI triggered objects, as their input changes are signaled by the EXTI edges*/
+			nxtDdln = mpbObj->getNxtDdln();
+			if(nxtDdln != 0){
+				curTm = xTaskGetTickCount() / portTICK_RATE_MS;
+				nxtDdln = (nxtDdln > curTm)?(nxtDdln - curTm):0;
+				if(mpbObj->_edgeTrgrd || (nxtDdln < nxtPollDelay))
+					nxtPollDelay = nxtDdln;
+				if(pdMS_TO_TICKS(nxtPollDelay) == 0)	//The expired or imminent deadline is solved in the next tick
+					nxtPollDelay = portTICK_RATE_MS;
+			}
+		}
+		if(nxtPollDelay != mpbObj->_curPollDelay){
+			if(xTimerChangePeriod(mpbTmrCbArg, pdMS_TO_TICKS(nxtPollDelay), 0) == pdPASS)
+				mpbObj->_curPollDelay = nxtPollDelay;
+		}
+	}
+
+	return;
+}
+
+void DbncdMPBttn::mpbPollUpd(){
 	BaseType_t xReturned;
 
 	taskENTER_CRITICAL();
-	if(mpbObj->getIsEnabled()){
+	if(getIsEnabled()){
 		// Input/Output signals update
-		mpbObj->updIsPressed();
+		updIsPressed();
 		// Flags/Triggers calculation & update
-		mpbObj->updValidPressesStatus();
+		updValidPressesStatus();
 	}
 	// State machine status update
-	mpbObj->updFdaState();
+	updFdaState();
 	taskEXIT_CRITICAL();
 
-	if (mpbObj->getOutputsChange()){	//Output changes might happen as part of the updFdaState() execution
-		if(mpbObj->getTaskToNotify() != NULL){
+	if (getOutputsChange()){	//Output changes might happen as part of the updFdaState() execution
+		if(getTaskToNotify() != NULL){
 			xReturned = xTaskNotify(
-					mpbObj->getTaskToNotify(),	//TaskHandle_t of the task receiving notification
-					static_cast<unsigned long>(mpbObj->getOtptsSttsPkgd()),
+					getTaskToNotify(),	//TaskHandle_t of the task receiving notification
+					static_cast<unsigned long>(getOtptsSttsPkgd()),
 					eSetValueWithOverwrite	//In this specific case using eSetBits is also a valid option
 					);
 			 if (xReturned != pdPASS){
 				 errorFlag = pdTRUE;
 			 }
-			 mpbObj->setOutputsChange(false);	//If the outputsChange triggers a task to treat it, here's  the flag reset, in other cases the mechanism reading the chganges must take care of the flag status
+			 setOutputsChange(false);	//If the outputsChange triggers a task to treat it, here's  the flag reset, in other cases the mechanism reading the chganges must take care of the flag status
 		}
 	}
 
@@ -430,11 +778,15 @@ bool DbncdMPBttn::pause(){
     BaseType_t tmrModResult {pdFAIL};
 
     if (_mpbPollTmrHndl){
+   	 _pollPsd = true;	//Keeps the EXTI edges from restarting the paused timer
    	 if (xTimerIsTimerActive(_mpbPollTmrHndl)){
    		 tmrModResult = xTimerStop(_mpbPollTmrHndl, portMAX_DELAY);
    		 if (tmrModResult == pdPASS)
    			 result = true;
    	 }
+   	 else if(_edgeTrgrd){
+   		 result = true;	//An EXTI triggered mode object's timer is expected to be stopped while idle
+   	 }
     }
     else{
    	 result = true;
@@ -443,18 +795,76 @@ bool DbncdMPBttn::pause(){
     return result;
 }
 
+void DbncdMPBttn::_pollWkp(){
+	/*Takes the timer of an EXTI triggered object or of an adaptive polling object to it's active polling rate when a method sets a condition to be solved by the state machine,
+	restarting the timer stopped while idle, or cutting short the slow poll delay or the wait for the next deadline. A dormant object in a Poll Group is woken up for the same reasons*/
+	unsigned long int nxtPollDelay {0};
+	bool chngPrd {false};
+	bool strtTmr {false};
+
+	if(_mpbPollGrp != nullptr)
+		_tmrWhlDrmnt = false;	//A dormant object in a Poll Group is updated in the next scan
+	if((_edgeTrgrd || _adptvPoll) && (_mpbPollTmrHndl != NULL) && !_pollPsd){
+		taskENTER_CRITICAL();
+		if(_edgeTrgrd)
+			_extiEdgePend = true;
+		nxtPollDelay = (_adptvPoll)?_fastPollDelay:_pollDelay;
+		chngPrd = (nxtPollDelay != _curPollDelay);	//The changed period (re)starts the timer
+		strtTmr = (!chngPrd && _edgeTrgrd && !_extiPollActv);
+		taskEXIT_CRITICAL();
+		//The timer commands are sent out of the critical section, they might need the timer daemon task to run
+		if(chngPrd){
+			if(xTimerChangePeriod(_mpbPollTmrHndl, pdMS_TO_TICKS(nxtPollDelay), 0) == pdPASS){
+				taskENTER_CRITICAL();
+				_curPollDelay = nxtPollDelay;
+				_extiPollActv = true;
+				taskEXIT_CRITICAL();
+			}
+		}
+		else if(strtTmr){
+			if(xTimerStart(_mpbPollTmrHndl, 0) == pdPASS)
+				_extiPollActv = true;
+		}
+	}
+
+	return;
+}
+
 void DbncdMPBttn::resetDbncTime(){
 	setDbncTime(_dbncTimeOrigSett);
 
     return;
 }
 
+void DbncdMPBttn::resetChttrStts(){
+	taskENTER_CRITICAL();
+	_bncTmAvg = 0;
+	_bncTmMax = 0;
+	_bncTrnsCnt = 0;
+	_bncTrnstnsCnt = 0;
+	_chttrTrnsCnt = 0;
+	_cntctDgrdd = false;
+	taskEXIT_CRITICAL();
+
+	return;
+}
+
+void DbncdMPBttn::resetPollsCnt(){
+	taskENTER_CRITICAL();
+	_pollsCnt = 0;
+	_pollsCntStrt = xTaskGetTickCount() / portTICK_RATE_MS;
+	taskEXIT_CRITICAL();
+
+	return;
+}
+
 void DbncdMPBttn::resetFda(){
 	taskENTER_CRITICAL();
 	clrStatus();
 	setSttChng();
 	_mpbFdaState = stOffNotVPP;
 	taskEXIT_CRITICAL();
+	_pollWkp();
 
 	return;
 }
@@ -462,12 +872,23 @@ void DbncdMPBttn::resetFda(){
 bool DbncdMPBttn::resume(){
 	bool result {false};
 	BaseType_t tmrModResult {pdFAIL};
+	unsigned long int nxtPollDelay {0};
 
 	resetFda();	//To restart in a safe situation the FDA is resetted to have all flags and timers cleaned up
 
 	if (_mpbPollTmrHndl){
 		if (xTimerIsTimerActive(_mpbPollTmrHndl) == pdFAIL){	// This enforces the timer to be stopped to let the timer be resumed, makes the method useless just to reset the timer counter
-			tmrModResult = xTimerReset( _mpbPollTmrHndl, portMAX_DELAY);
+			_pollPsd = false;
+			_extiPollActv = true;
+			nxtPollDelay = (_adptvPoll)?_fastPollDelay:_pollDelay;
+			if(nxtPollDelay != _curPollDelay){	//The changed period starts the timer
+				tmrModResult = xTimerChangePeriod(_mpbPollTmrHndl, pdMS_TO_TICKS(nxtPollDelay), portMAX_DELAY);
+				if (tmrModResult == pdPASS)
+					_curPollDelay = nxtPollDelay;
+			}
+			else{
+				tmrModResult = xTimerReset( _mpbPollTmrHndl, portMAX_DELAY);
+			}
 			if (tmrModResult == pdPASS)
 				result = true;
 		}
@@ -476,6 +897,64 @@ bool DbncdMPBttn::resume(){
 	return result;
 }
 
+bool DbncdMPBttn::setAdptvPoll(const bool &newAdptvPoll, const unsigned long int &fastPollDelay, const unsigned long int &slowPollDelay){
+	bool result {false};
+	unsigned long int nxtPollDelay {0};
+
+	if((pdMS_TO_TICKS(fastPollDelay) > 0) && (slowPollDelay >= fastPollDelay)){
+		taskENTER_CRITICAL();
+		_fastPollDelay = fastPollDelay;
+		_slowPollDelay = slowPollDelay;
+		_adptvPoll = newAdptvPoll;
+		taskEXIT_CRITICAL();
+		if(_mpbPollTmrHndl != NULL){
+			nxtPollDelay = (_adptvPoll)?_fastPollDelay:_pollDelay;
+			if((nxtPollDelay != _curPollDelay) && (xTimerIsTimerActive(_mpbPollTmrHndl) != pdFAIL)){	//Changing the period of a stopped timer would start it
+				if(xTimerChangePeriod(_mpbPollTmrHndl, pdMS_TO_TICKS(nxtPollDelay), portMAX_DELAY) == pdPASS)
+					_curPollDelay = nxtPollDelay;
+			}
+		}
+		result = true;
+	}
+
+	return result;
+}
+
+bool DbncdMPBttn::setCntctDgrdThrshld(const unsigned long int &newBncTmThrshld, const uint8_t &avgShft){
+	bool result {false};
+
+	if((avgShft >= 1) && (avgShft <= 8)){
+		taskENTER_CRITICAL();
+		_cntctDgrdThrshld = (newBncTmThrshld > 0xFFFF)?0xFFFF:newBncTmThrshld;
+		_bncTmAvgShft = avgShft;
+		taskEXIT_CRITICAL();
+		result = true;
+	}
+
+	return result;
+}
+
+bool DbncdMPBttn::setDbncLrn(const bool &newDbncLrn, const uint8_t &prcntl, const unsigned long int &mrgn, const unsigned long int &dbncMin, const unsigned long int &dbncMax){
+	bool result {false};
+
+	if((prcntl <= 100) && (dbncMin > 0) && (dbncMax >= dbncMin)){
+		taskENTER_CRITICAL();
+		if(newDbncLrn && !_dbncLrn){
+			_dbncLrnSmplsCnt = 0;
+			_dbncLrnSmplsIdx = 0;
+		}
+		_dbncLrnPrcntl = prcntl;
+		_dbncLrnMrgn = mrgn;
+		_dbncLrnMin = dbncMin;
+		_dbncLrnMax = dbncMax;
+		_dbncLrn = newDbncLrn;
+		taskEXIT_CRITICAL();
+		result = true;
+	}
+
+	return result;
+}
+
 bool DbncdMPBttn::setDbncTime(const unsigned long int &newDbncTime){
     bool result {true};
 
@@ -493,65 +972,265 @@ bool DbncdMPBttn::setDbncTime(const unsigned long int &newDbncTime){
     return result;
 }
 
-void DbncdMPBttn::setFnWhnTrnOffPtr(void (*newFnWhnTrnOff)()){
-	taskENTER_CRITICAL();
-	if (_fnWhnTrnOff != newFnWhnTrnOff){
-		_fnWhnTrnOff = newFnWhnTrnOff;
+bool DbncdMPBttn::setExtiTrgrd(const bool &newExtiTrgrd){
+	bool result {false};
+	uint8_t extiLine {singleBitPosNum(_mpbttnPin)};
+	GPIO_InitTypeDef GPIO_InitStruct {0};
+	IRQn_Type extiIRQn {EXTI0_IRQn};
+
+	if((_mpbttnPin != _InvalidPinNum) && (extiLine < 16) && (_mpbPollGrp == nullptr) && (_inptSrc == nullptr) && (_cptrTimHndl == NULL)){
+		if(_extiTrgrd == newExtiTrgrd){
+			result = true;
+		}
+		else if(newExtiTrgrd){
+			taskENTER_CRITICAL();
+			if(_extiMpbLst[extiLine] == nullptr){
+				_extiMpbLst[extiLine] = this;
+				_extiTrgrd = true;
+				_edgeTrgrd = true;	//The polling is restarted by the EXTI edges
+				result = true;
+			}
+			taskEXIT_CRITICAL();
+			if(result){
+				/*Reconfigure GPIO pin : _mpbttnPin to generate EXTI interrupts on both edges*/
+				GPIO_InitStruct.Pin = _mpbttnPin;
+				GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;
+				GPIO_InitStruct.Pull = (_pulledUp == true)?GPIO_PULLUP:GPIO_PULLDOWN;
+				HAL_GPIO_Init(_mpbttnPort, &GPIO_InitStruct);
+
+				if(extiLine < 5)
+					extiIRQn = static_cast<IRQn_Type>(EXTI0_IRQn + extiLine);
+				else if(extiLine < 10)
+					extiIRQn = EXTI9_5_IRQn;
+				else
+					extiIRQn = EXTI15_10_IRQn;
+				HAL_NVIC_SetPriority(extiIRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, 0);	//Highest priority allowed to use the FreeRTOS "FromISR" API
+				HAL_NVIC_EnableIRQ(extiIRQn);	//The EXTIx lines 5 to 15 share their IRQs, other MPBs might have it already enabled
+
+				_pollWkp();	//The timer settles the current input state before waiting for the first edge
+			}
+		}
+		else{
+			taskENTER_CRITICAL();
+			_extiMpbLst[extiLine] = nullptr;
+			_extiTrgrd = false;
+			_edgeTrgrd = false;
+			taskEXIT_CRITICAL();
+
+			/*Configure back GPIO pin : _mpbttnPin as a plain input, the de-initialization clears the EXTI line configuration*/
+			HAL_GPIO_DeInit(_mpbttnPort, _mpbttnPin);
+			GPIO_InitStruct.Pin = _mpbttnPin;
+			GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+			GPIO_InitStruct.Pull = (_pulledUp == true)?GPIO_PULLUP:GPIO_PULLDOWN;
+			HAL_GPIO_Init(_mpbttnPort, &GPIO_InitStruct);
+
+			if((_mpbPollTmrHndl != NULL) && !_pollPsd){	//Back to plain periodic polling
+				if(xTimerIsTimerActive(_mpbPollTmrHndl) == pdFAIL)
+					xTimerStart(_mpbPollTmrHndl, portMAX_DELAY);
+			}
+			_extiPollActv = false;
+			result = true;
+		}
 	}
-	taskEXIT_CRITICAL();
 
-	return;
+	return result;
 }
 
-void DbncdMPBttn::setFnWhnTrnOnPtr(void (*newFnWhnTrnOn)()){
+void DbncdMPBttn::setFnWhnCntctDgrddPtr(void (*newFnWhnCntctDgrdd)()){
 	taskENTER_CRITICAL();
-	if (_fnWhnTrnOn != newFnWhnTrnOn){
-		_fnWhnTrnOn = newFnWhnTrnOn;
+	if (_fnWhnCntctDgrdd != newFnWhnCntctDgrdd){
+		_fnWhnCntctDgrdd = newFnWhnCntctDgrdd;
 	}
 	taskEXIT_CRITICAL();
 
 	return;
 }
 
-void DbncdMPBttn::_setIsEnabled(const bool &newEnabledValue){
+void DbncdMPBttn::setFnWhnTrnOffPtr(void (*newFnWhnTrnOff)()){
 	taskENTER_CRITICAL();
-	if(_isEnabled != newEnabledValue){
-		if (newEnabledValue){  //Change to Enabled = true
-			_validEnablePend = true;
-			if(_validDisablePend)
-				_validDisablePend = false;
-		}
-		else{	//Change to Enabled = false  (i.e. Disabled)
-			_validDisablePend = true;
-			if(_validEnablePend)
-				_validEnablePend = false;
-		}
+	if (_fnWhnTrnOff != newFnWhnTrnOff){
+		_fnWhnTrnOff = newFnWhnTrnOff;
 	}
 	taskEXIT_CRITICAL();
 
 	return;
 }
 
-void DbncdMPBttn::setIsOnDisabled(const bool &newIsOnDisabled){
+void DbncdMPBttn::setFnWhnTrnOnPtr(void (*newFnWhnTrnOn)()){
 	taskENTER_CRITICAL();
-	if(_isOnDisabled != newIsOnDisabled){
-		_isOnDisabled = newIsOnDisabled;
-		if(!_isEnabled){
-			if(_isOn != _isOnDisabled){
-				if(_isOnDisabled){
-					_turnOn();
-				}
-				else{
-					_turnOff();
-				}
-			}
-		}
+	if (_fnWhnTrnOn != newFnWhnTrnOn){
+		_fnWhnTrnOn = newFnWhnTrnOn;
 	}
 	taskEXIT_CRITICAL();
 
 	return;
 }
 
+bool DbncdMPBttn::setHwFltr(TIM_HandleTypeDef* timHndl, const uint32_t &timChnl, const uint32_t &timClkHz, const unsigned long int &fltrTmNs, const bool &swDbnc){
+	bool result {false};
+	uint8_t ckdDiv {1};
+	uint8_t icFltr {0};
+	uint8_t lstSlot {_cptrMpbLstLen};
+	TIM_IC_InitTypeDef sConfigIC {0};
+
+	if(timHndl == NULL){
+		if(_cptrTimHndl != NULL){
+			HAL_TIM_IC_Stop_IT(_cptrTimHndl, _cptrTimChnl);
+			taskENTER_CRITICAL();
+			for(uint8_t slot{0}; slot < _cptrMpbLstLen; ++slot){
+				if(_cptrMpbLst[slot] == this)
+					_cptrMpbLst[slot] = nullptr;
+			}
+			_cptrTimHndl = NULL;
+			_cptrActvChnl = HAL_TIM_ACTIVE_CHANNEL_CLEARED;
+			_cptrUsTmStmp = false;
+			_hwFltrTmNs = 0;
+			_xtrnSmplng = false;
+			_xtrnDbncd = false;
+			_edgeTrgrd = false;
+			taskEXIT_CRITICAL();
+
+			if((_mpbPollTmrHndl != NULL) && !_pollPsd){	//Back to plain periodic polling
+				if(xTimerIsTimerActive(_mpbPollTmrHndl) == pdFAIL)
+					xTimerStart(_mpbPollTmrHndl, portMAX_DELAY);
+			}
+			_extiPollActv = false;
+		}
+		result = true;
+	}
+	else if((_mpbttnPin != _InvalidPinNum) && (_mpbPollGrp == nullptr) && (_inptSrc == nullptr) && !_extiTrgrd && (_cptrTimHndl == NULL) && (timClkHz > 0) &&
+			((timChnl == TIM_CHANNEL_1) || (timChnl == TIM_CHANNEL_2) || (timChnl == TIM_CHANNEL_3) || (timChnl == TIM_CHANNEL_4))){
+		taskENTER_CRITICAL();
+		for(uint8_t slot{0}; (slot < _cptrMpbLstLen) && (lstSlot == _cptrMpbLstLen); ++slot){
+			if(_cptrMpbLst[slot] == nullptr)
+				lstSlot = slot;
+		}
+		if(lstSlot < _cptrMpbLstLen)
+			_cptrMpbLst[lstSlot] = this;
+		taskEXIT_CRITICAL();
+
+		if(lstSlot < _cptrMpbLstLen){
+			if(timHndl->Init.ClockDivision == TIM_CLOCKDIVISION_DIV2)
+				ckdDiv = 2;
+			else if(timHndl->Init.ClockDivision == TIM_CLOCKDIVISION_DIV4)
+				ckdDiv = 4;
+			icFltr = icFltrFor(timClkHz, ckdDiv, fltrTmNs);
+
+			sConfigIC.ICPolarity = TIM_INPUTCHANNELPOLARITY_BOTHEDGE;
+			sConfigIC.ICSelection = TIM_ICSELECTION_DIRECTTI;
+			sConfigIC.ICPrescaler = TIM_ICPSC_DIV1;
+			sConfigIC.ICFilter = icFltr;
+			if(HAL_TIM_IC_ConfigChannel(timHndl, &sConfigIC, timChnl) == HAL_OK){
+				taskENTER_CRITICAL();
+				_cptrTimHndl = timHndl;
+				_cptrTimChnl = timChnl;
+				_cptrActvChnl = static_cast<HAL_TIM_ActiveChannel>(1 << (timChnl / TIM_CHANNEL_2));	//TIM_CHANNEL_x values are 4 apart, HAL_TIM_ACTIVE_CHANNEL_x values are single bits
+				//Only a free running 32 bits counter at 1 MHz wraps around at the 32 bits microseconds range, other counters can't provide the timestamps
+				_cptrUsTmStmp = (IS_TIM_32B_COUNTER_INSTANCE(timHndl->Instance) && (timHndl->Init.Period == 0xFFFFFFFF) && ((timClkHz / (timHndl->Init.Prescaler + 1)) == 1000000));
+				_hwFltrTmNs = icFltrTmNs(timClkHz, ckdDiv, icFltr);
+				_xtrnPinLvl = (HAL_GPIO_ReadPin(_mpbttnPort, _mpbttnPin) == GPIO_PIN_SET);
+				_xtrnPinLvlChng = false;
+				_xtrnSmplng = true;
+				_xtrnDbncd = !swDbnc;	//The filtered edges need no software debouncing
+				_edgeTrgrd = true;	//The polling is restarted by the captured edges, the object is not in EXTI triggered mode
+				taskEXIT_CRITICAL();
+				if(HAL_TIM_IC_Start_IT(timHndl, timChnl) == HAL_OK){
+					_pollWkp();	//The timer settles the current input state before waiting for the first edge
+					result = true;
+				}
+				else{
+					setHwFltr(NULL, 0, 0, 0);
+				}
+			}
+			else{
+				taskENTER_CRITICAL();
+				_cptrMpbLst[lstSlot] = nullptr;
+				taskEXIT_CRITICAL();
+			}
+		}
+	}
+
+	return result;
+}
+
+bool DbncdMPBttn::setInptSrc(MPBttnInptSrc* newInptSrc, const uint16_t &newInptId){
+	bool result {false};
+
+	if((_mpbPollTmrHndl == NULL) && (_mpbPollGrp == nullptr) && !_edgeTrgrd){
+		if((newInptSrc == nullptr) || (newInptId < newInptSrc->getInptsQty())){
+			taskENTER_CRITICAL();
+			_inptSrc = newInptSrc;
+			_inptSrcId = (newInptSrc == nullptr)?0:newInptId;
+			taskEXIT_CRITICAL();
+			result = true;
+		}
+	}
+
+	return result;
+}
+
+void DbncdMPBttn::_setPrssdLvlInvMsk(){
+	//The pin reads LOW when pressed for NO pulled up and NC pulled down MPBs, for those the pin level must be inverted
+	_prssdLvlInvMsk = (_typeNO == _pulledUp)?_mpbttnPin:0;
+
+	return;
+}
+
+void DbncdMPBttn::_setIsEnabled(const bool &newEnabledValue){
+	taskENTER_CRITICAL();
+	if(_isEnabled != newEnabledValue){
+		if (newEnabledValue){  //Change to Enabled = true
+			_validEnablePend = true;
+			if(_validDisablePend)
+				_validDisablePend = false;
+		}
+		else{	//Change to Enabled = false  (i.e. Disabled)
+			_validDisablePend = true;
+			if(_validEnablePend)
+				_validEnablePend = false;
+		}
+	}
+	taskEXIT_CRITICAL();
+	_pollWkp();
+
+	return;
+}
+
+void DbncdMPBttn::setIsOnDisabled(const bool &newIsOnDisabled){
+	taskENTER_CRITICAL();
+	if(_isOnDisabled != newIsOnDisabled){
+		_isOnDisabled = newIsOnDisabled;
+		if(!_isEnabled){
+			if(_isOn != _isOnDisabled){
+				if(_isOnDisabled){
+					_turnOn();
+				}
+				else{
+					_turnOff();
+				}
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return;
+}
+
+void DbncdMPBttn::setMinOnTm(const unsigned long int &newMinOnTm){
+	bool chngd {false};
+
+	taskENTER_CRITICAL();
+	if(_minOnTm != newMinOnTm){
+		_minOnTm = newMinOnTm;
+		chngd = true;
+	}
+	taskEXIT_CRITICAL();
+	if(chngd)
+		_pollWkp();	//The pending deadline, if any, must be recalculated
+
+	return;
+}
+
 void DbncdMPBttn::setOutputsChange(bool newOutputsChange){
 	taskENTER_CRITICAL();
 	if(_outputsChange != newOutputsChange)
@@ -698,6 +1377,7 @@ void DbncdMPBttn::updFdaState(){
 			if(!_isOn){
 				_turnOn();
 			}
+			_onTmStrt = xTaskGetTickCount() / portTICK_RATE_MS;
 			_validPressPend = false;
 			_mpbFdaState = stOn;
 			setSttChng();
@@ -725,12 +1405,27 @@ void DbncdMPBttn::updFdaState(){
 			//In: >>---------------------------------->>
 			if(_sttChng){clrSttChng();}	// Execute this code only ONCE, when entering this state
 			//Do: >>---------------------------------->>
-			if(_isOn){
-				_turnOff();
-			}
 			_validReleasePend = false;
-			_mpbFdaState = stOffNotVPP;
-			setSttChng();
+			if(_isOn && (_minOnTm > 0) && (((xTaskGetTickCount() / portTICK_RATE_MS) - _onTmStrt) < _minOnTm)){
+				//The On pulse is stretched until the minimum On time is completed
+				if(_validPressPend){
+					_onTmStrt = xTaskGetTickCount() / portTICK_RATE_MS;
+					_validPressPend = false;
+					_mpbFdaState = stOn;
+					setSttChng();
+				}
+				else if(_validDisablePend){
+					_mpbFdaState = stDisabled;
+					setSttChng();	//Set flag to execute exiting OUT code
+				}
+			}
+			else{
+				if(_isOn){
+					_turnOff();
+				}
+				_mpbFdaState = stOffNotVPP;
+				setSttChng();
+			}
 			//Out: >>---------------------------------->>
 			if(_sttChng){}	// Execute this code only ONCE, when exiting this state
 			break;
@@ -779,7 +1474,7 @@ void DbncdMPBttn::updFdaState(){
 	return;
 }
 
-bool DbncdMPBttn::updIsPressed(){
+bool DbncdMPBttn::_rdIsPressed(){
 	/*To be 'pressed' the conditions are:
    1) For NO == true
    	a) _pulledUp == false ==> digitalRead == HIGH
@@ -787,34 +1482,46 @@ bool DbncdMPBttn::updIsPressed(){
    2) For NO == false
    	a) _pulledUp == false ==> digitalRead == LOW
       b) _pulledUp == true ==> digitalRead == HIGH
+   The conditions are folded in the _prssdLvlInvMsk by _setPrssdLvlInvMsk(), so the pressed status is the pin level XOR the mask, with no branching on the polarity settings
     */
 	bool result {false};
-   bool tmpPinLvlSet {false};
 
-   if(HAL_GPIO_ReadPin(_mpbttnPort, _mpbttnPin) == GPIO_PIN_SET)
-   	tmpPinLvlSet = true;
+   if(_xtrnSmplng)
+   	result = ((((_xtrnPinLvl)?_mpbttnPin:0) ^ _prssdLvlInvMsk) & _mpbttnPin) != 0;	//The pin level is provided by a sampling mechanism, see MPBttnDmaSmplr
+   else if(_portSnpsht != nullptr)
+   	result = ((*_portSnpsht & _mpbttnPin) != 0);	//The port snapshot of the Poll Group scan is already polarity normalized, see MPBttnPollGrp
+   else if(_inptSrc != nullptr)
+   	result = (_inptSrc->getInptLvl(_inptSrcId) != (_prssdLvlInvMsk != 0));	//The input level is provided by an input source, see MPBttnInptSrc
+   else
+   	result = (((_mpbttnPort->IDR) ^ _prssdLvlInvMsk) & _mpbttnPin) != 0;
 
-   if (_typeNO == true){
-   	//For NO MPBs
-      if (_pulledUp == false){
-      	if (tmpPinLvlSet == true)
-      		result = true;
-      }
-      else{
-      	if (tmpPinLvlSet == false)
-      		result = true;
-      }
-   }
-   else{
-   	//For NC MPBs
-		if (_pulledUp == false){
-			if (tmpPinLvlSet == false)
-				result = true;
-		}
-      else{
-      	if (tmpPinLvlSet == true)
-      		result = true;
-      }
+   return result;
+}
+
+bool DbncdMPBttn::updIsPressed(){
+	//The input is read with no side effects, the pressed status and the sampled level change flags are updated here
+	bool result {_rdIsPressed()};
+
+   if(_xtrnSmplng && _xtrnPinLvlChng){
+   	//The debounce of the sampled level is timed from the sample where the level changed, not from the time it's processed
+   	unsigned long int lvlChngTm {_xtrnPinLvlTm};
+
+   	_xtrnPinLvlChng = false;
+   	if(result){
+   		_dbncTimerStrt = lvlChngTm;
+   		_dbncRlsTimerStrt = 0;
+   		_bncTrnIntr(1, lvlChngTm);
+   		if(!_prssRlsCcl)
+   			_bncTrnDtct(0, lvlChngTm, (_xtrnDbncd || _plcyDbncd)?0:_dbncTimeTempSett);
+   	}
+   	else{
+   		_dbncTimerStrt = 0;
+   		_bncTrnIntr(0, lvlChngTm);
+   		if(_prssRlsCcl){
+   			_dbncRlsTimerStrt = lvlChngTm;
+   			_bncTrnDtct(1, lvlChngTm, (_xtrnDbncd || _plcyDbncd)?0:_dbncRlsTimeTempSett);
+   		}
+   	}
    }
    _isPressed = result;
 
@@ -822,34 +1529,44 @@ bool DbncdMPBttn::updIsPressed(){
 }
 
 bool DbncdMPBttn::updValidPressesStatus(){
+	//An input already debounced by the servicing mechanism (see MPBttnPollGrp::setVrtclDbnc(const bool&, const uint8_t&)) or by a debounce policy (see DbncPlcyMPBttn) needs no debouncing time
+	unsigned long int dbncTime {(_xtrnDbncd || _plcyDbncd)?0:_dbncTimeTempSett};
+	unsigned long int dbncRlsTime {(_xtrnDbncd || _plcyDbncd)?0:_dbncRlsTimeTempSett};
+
 	if(_isPressed){
-		if(_dbncRlsTimerStrt != 0)
+		if(_dbncRlsTimerStrt != 0){
 			_dbncRlsTimerStrt = 0;
+			_bncTrnIntr(1, xTaskGetTickCount() / portTICK_RATE_MS);	//Release bounce
+		}
 		if(!_prssRlsCcl){
 			if(_dbncTimerStrt == 0){    //This is the first detection of the press event
 				_dbncTimerStrt = xTaskGetTickCount() / portTICK_RATE_MS;	//Started to be pressed
+				_bncTrnDtct(0, _dbncTimerStrt, dbncTime);
 			}
-			else{
-				if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncTimerStrt) >= (_dbncTimeTempSett + _strtDelay)){
-					_validPressPend = true;
-					_validReleasePend = false;
-					_prssRlsCcl = true;
-				}
+			if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncTimerStrt) >= (dbncTime + _strtDelay)){
+				_validPressPend = true;
+				_validReleasePend = false;
+				_prssRlsCcl = true;
+				_lastPrssTmStmp = _edgeTmStmp(_dbncTimerStrt);
+				_bncTrnVldt(0, _dbncTimerStrt);
 			}
 		}
 	}
 	else{
-		if(_dbncTimerStrt != 0)
+		if(_dbncTimerStrt != 0){
 			_dbncTimerStrt = 0;
+			_bncTrnIntr(0, xTaskGetTickCount() / portTICK_RATE_MS);	//Press bounce
+		}
 		if(_prssRlsCcl){
 			if(_dbncRlsTimerStrt == 0){    //This is the first detection of the release event
 				_dbncRlsTimerStrt = xTaskGetTickCount() / portTICK_RATE_MS;	//Started to be UNpressed
+				_bncTrnDtct(1, _dbncRlsTimerStrt, dbncRlsTime);
 			}
-			else{
-				if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncRlsTimerStrt) >= (_dbncRlsTimeTempSett)){
-					_validReleasePend = true;
-					_prssRlsCcl = false;
-				}
+			if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncRlsTimerStrt) >= (dbncRlsTime)){
+				_validReleasePend = true;
+				_prssRlsCcl = false;
+				_lastRlsTmStmp = _edgeTmStmp(_dbncRlsTimerStrt);
+				_bncTrnVldt(1, _dbncRlsTimerStrt);
 			}
 		}
 	}
@@ -912,30 +1629,6 @@ LtchMPBttn::LtchMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp, const b
 {
 }
 
-bool LtchMPBttn::begin(const unsigned long int &pollDelayMs){
-   bool result {false};
-   BaseType_t tmrModResult {pdFAIL};
-
-   if (pollDelayMs > 0){
-   	if (!_mpbPollTmrHndl){
-   		_mpbPollTmrHndl = xTimerCreate(
-   				_mpbPollTmrName.c_str(),  //Timer name
-				pdMS_TO_TICKS(pollDelayMs),  //Timer period in ticks
-				pdTRUE,     //Auto-reload true
-				this,       //TimerID: data passed to the callback function to work
-				mpbPollCallback
-			);
-         if (_mpbPollTmrHndl != NULL){
-            tmrModResult = xTimerStart(_mpbPollTmrHndl, portMAX_DELAY);
-         	if (tmrModResult == pdPASS)
-               result = true;
-         }
-   	}
-	}
-
-	return result;
-}
-
 void LtchMPBttn::clrStatus(bool clrIsOn){
 	taskENTER_CRITICAL();
 	_isLatched = false;
@@ -962,30 +1655,34 @@ const bool LtchMPBttn::getUnlatchPend() const{
 	return _validUnlatchPend;
 }
 
-void LtchMPBttn::mpbPollCallback(TimerHandle_t mpbTmrCbArg){
-    LtchMPBttn* mpbObj = (LtchMPBttn*)pvTimerGetTimerID(mpbTmrCbArg);
+bool LtchMPBttn::_isStbl(){
+
+	return (DbncdMPBttn::_isStbl() && !_validUnlatchPend && !_validUnlatchRlsPend);
+}
+
+void LtchMPBttn::mpbPollUpd(){
 
     taskENTER_CRITICAL();
-    if(mpbObj->getIsEnabled()){
+    if(getIsEnabled()){
 		// Input/Output signals update
-		mpbObj->updIsPressed();
+		updIsPressed();
 		// Flags/Triggers calculation & update
-		mpbObj->updValidPressesStatus();
-		mpbObj->updValidUnlatchStatus();
+		updValidPressesStatus();
+		updValidUnlatchStatus();
  	}
 	// State machine state update
-	mpbObj->updFdaState();
+	updFdaState();
 	taskEXIT_CRITICAL();
 
 	//Outputs update based on outputsChange flag
-	if (mpbObj->getOutputsChange()){
-		if(mpbObj->getTaskToNotify() != NULL){
+	if (getOutputsChange()){
+		if(getTaskToNotify() != NULL){
 			xTaskNotify(
-					mpbObj->getTaskToNotify(),	//TaskHandle_t of the task receiving notification
-					static_cast<unsigned long>(mpbObj->getOtptsSttsPkgd()),
+					getTaskToNotify(),	//TaskHandle_t of the task receiving notification
+					static_cast<unsigned long>(getOtptsSttsPkgd()),
 					eSetValueWithOverwrite
 			);
-			mpbObj->setOutputsChange(false);
+			setOutputsChange(false);
 		}
 	}
 
@@ -1005,6 +1702,7 @@ void LtchMPBttn::setUnlatchPend(const bool &newVal){
 	if(_validUnlatchPend != newVal)
 		_validUnlatchPend = newVal;
 	taskEXIT_CRITICAL();
+	_pollWkp();
 
 	return;
 }
@@ -1014,6 +1712,7 @@ void LtchMPBttn::setUnlatchRlsPend(const bool &newVal){
 	if(_validUnlatchRlsPend != newVal)
 		_validUnlatchRlsPend = newVal;
 	taskEXIT_CRITICAL();
+	_pollWkp();
 
 	return;
 }
@@ -1293,6 +1992,19 @@ void TmLtchMPBttn::clrStatus(bool clrIsOn){
 	return;
 }
 
+const unsigned long int TmLtchMPBttn::getNxtDdln() const{
+	unsigned long int result {DbncdMPBttn::getNxtDdln()};
+	unsigned long int srvcDdln {0};
+
+	if(_isEnabled && _isLatched && !_validUnlatchPend && (_srvcTimerStrt != 0)){
+		srvcDdln = _srvcTimerStrt + _srvcTime;	//Service time end
+		if((result == 0) || (srvcDdln < result))
+			result = srvcDdln;
+	}
+
+	return result;
+}
+
 const unsigned long int TmLtchMPBttn::getSrvcTime() const{
 
 	return _srvcTime;
@@ -1300,17 +2012,21 @@ const unsigned long int TmLtchMPBttn::getSrvcTime() const{
 
 bool TmLtchMPBttn::setSrvcTime(const unsigned long int &newSrvcTime){
 	bool result {true};
+	bool chngd {false};
 
    taskENTER_CRITICAL();
 	if (_srvcTime != newSrvcTime){
 		if (newSrvcTime >= _MinSrvcTime){  //The minimum activation time is _minActTime milliseconds
 			_srvcTime = newSrvcTime;
+			chngd = true;
 		}
 		else{
 			result = false;
 		}
    }
 	taskEXIT_CRITICAL();
+	if(chngd)
+		_pollWkp();	//The pending deadline, if any, must be recalculated
 
    return result;
 }
@@ -1324,6 +2040,11 @@ void TmLtchMPBttn::setTmerRstbl(const bool &newIsRstbl){
     return;
 }
 
+bool TmLtchMPBttn::_isTmdSttPend(){
+
+	return (_isOn && (_srvcTimerStrt != 0));	//The service time is running
+}
+
 void TmLtchMPBttn::stOffNotVPP_Out(){
 	_srvcTimerStrt = 0;
 
@@ -1366,30 +2087,6 @@ HntdTmLtchMPBttn::HntdTmLtchMPBttn(gpioPinId_t mpbttnPinStrct, const unsigned lo
 {
 }
 
-bool HntdTmLtchMPBttn::begin(const unsigned long int &pollDelayMs){
-   bool result {false};
-   BaseType_t tmrModResult {pdFAIL};
-
-   if (pollDelayMs > 0){
-		if (!_mpbPollTmrHndl){
-			_mpbPollTmrHndl = xTimerCreate(
-					_mpbPollTmrName.c_str(),  //Timer name
-				pdMS_TO_TICKS(pollDelayMs),  //Timer period in ticks
-				pdTRUE,     //Auto-reload true
-				this,       //TimerID: data passed to the callback function to work
-				mpbPollCallback
-				);
-			if (_mpbPollTmrHndl != NULL){
-				tmrModResult = xTimerStart(_mpbPollTmrHndl, portMAX_DELAY);
-				if (tmrModResult == pdPASS)
-					result = true;
-			}
-		}
-   }
-
-   return result;
-}
-
 void HntdTmLtchMPBttn::clrStatus(bool clrIsOn){
 //	Put here class specific sets/resets, including pilot and warning
 	taskENTER_CRITICAL();
@@ -1423,6 +2120,19 @@ fncPtrType HntdTmLtchMPBttn::getFnWhnTrnOnWrnng(){
 	return _fnWhnTrnOnWrnng;
 }
 
+const unsigned long int HntdTmLtchMPBttn::getNxtDdln() const{
+	unsigned long int result {TmLtchMPBttn::getNxtDdln()};
+	unsigned long int wrnngDdln {0};
+
+	if((_wrnngPrctg > 0) && _isEnabled && _isOn && !_wrnngOn && (_srvcTimerStrt != 0)){
+		wrnngDdln = _srvcTimerStrt + (_srvcTime - _wrnngMs);	//Warning period start
+		if((result == 0) || (wrnngDdln < result))
+			result = wrnngDdln;
+	}
+
+	return result;
+}
+
 const bool HntdTmLtchMPBttn::getPilotOn() const{
 
     return _pilotOn;
@@ -1433,31 +2143,35 @@ const bool HntdTmLtchMPBttn::getWrnngOn() const{
     return _wrnngOn;
 }
 
-void HntdTmLtchMPBttn::mpbPollCallback(TimerHandle_t mpbTmrCbArg){
-	HntdTmLtchMPBttn* mpbObj = (HntdTmLtchMPBttn*)pvTimerGetTimerID(mpbTmrCbArg);
+bool HntdTmLtchMPBttn::_isStbl(){
+
+	return (LtchMPBttn::_isStbl() && !_validWrnngSetPend && !_validWrnngResetPend && !_validPilotSetPend && !_validPilotResetPend);
+}
+
+void HntdTmLtchMPBttn::mpbPollUpd(){
 
 	taskENTER_CRITICAL();
-	if(mpbObj->getIsEnabled()){
+	if(getIsEnabled()){
 		// Input/Output signals update
-		mpbObj->updIsPressed();
+		updIsPressed();
 		// Flags/Triggers calculation & update
-		mpbObj->updValidPressesStatus();
-		mpbObj->updValidUnlatchStatus();
-		mpbObj->updWrnngOn();
-		mpbObj->updPilotOn();
+		updValidPressesStatus();
+		updValidUnlatchStatus();
+		updWrnngOn();
+		updPilotOn();
 	}
  	// State machine state update
- 	mpbObj->updFdaState();
+ 	updFdaState();
  	taskEXIT_CRITICAL();
 
-	if (mpbObj->getOutputsChange()){
-		if(mpbObj->getTaskToNotify() != NULL){
+	if (getOutputsChange()){
+		if(getTaskToNotify() != NULL){
 			xTaskNotify(
-					mpbObj->getTaskToNotify(),	//TaskHandle_t of the task receiving notification
-					static_cast<unsigned long>(mpbObj->getOtptsSttsPkgd()),
+					getTaskToNotify(),	//TaskHandle_t of the task receiving notification
+					static_cast<unsigned long>(getOtptsSttsPkgd()),
 					eSetValueWithOverwrite
 			);
-			mpbObj->setOutputsChange(false);
+			setOutputsChange(false);
 		}
 	}
 
@@ -1527,6 +2241,7 @@ void HntdTmLtchMPBttn::setKeepPilot(const bool &newKeepPilot){
 	if(_keepPilot != newKeepPilot)
 		_keepPilot = newKeepPilot;
 	taskEXIT_CRITICAL();
+	_pollWkp();
 
 	return;
 }
@@ -1534,13 +2249,14 @@ void HntdTmLtchMPBttn::setKeepPilot(const bool &newKeepPilot){
 bool HntdTmLtchMPBttn::setSrvcTime(const unsigned long int &newSrvcTime){
 	bool result {true};
 
-	taskENTER_CRITICAL();
 	if (newSrvcTime != _srvcTime){
-		result = TmLtchMPBttn::setSrvcTime(newSrvcTime);
-		if (result)
+		result = TmLtchMPBttn::setSrvcTime(newSrvcTime);	//The base setter wakes the polling up, it must not be invoked inside a critical section
+		if (result){
+			taskENTER_CRITICAL();
 			_wrnngMs = (_srvcTime * _wrnngPrctg) / 100;  //If the _srvcTime was changed, the _wrnngMs must be updated as it's a percentage of the first
+			taskEXIT_CRITICAL();
+		}
 	}
-	taskEXIT_CRITICAL();
 
 	return result;
 }
@@ -1557,6 +2273,8 @@ bool HntdTmLtchMPBttn::setWrnngPrctg (const unsigned int &newWrnngPrctg){
 		}
 	}
 	taskEXIT_CRITICAL();
+	if(result)
+		_pollWkp();	//The pending deadline, if any, must be recalculated
 
 	return result;
 }
@@ -1788,27 +2506,11 @@ XtrnUnltchMPBttn::XtrnUnltchMPBttn(gpioPinId_t mpbttnPinStrct,
 
 bool XtrnUnltchMPBttn::begin(const unsigned long int &pollDelayMs){
    bool result {false};
-   BaseType_t tmrModResult {pdFAIL};
 
-   if (pollDelayMs > 0){
-		if (!_mpbPollTmrHndl){
-			_mpbPollTmrHndl = xTimerCreate(
-					_mpbPollTmrName.c_str(),  //Timer name
-				pdMS_TO_TICKS(pollDelayMs),  //Timer period in ticks
-				pdTRUE,     //Auto-reload true
-				this,       //TimerID: data passed to the callback function to work
-				mpbPollCallback
-			);
-		}
-		if (_mpbPollTmrHndl != NULL){
-			tmrModResult = xTimerStart(_mpbPollTmrHndl, portMAX_DELAY);
-			if (tmrModResult == pdPASS){
-				if(_unLtchBttn != nullptr)
-					result = _unLtchBttn->begin();
-				else
-					result = true;
-			}
-		}
+   result = DbncdMPBttn::begin(pollDelayMs);
+   if(result){
+		if((_unLtchBttn != nullptr) && (_unLtchBttn->getMPBttnPollGrp() == nullptr))
+			result = _unLtchBttn->begin();
    }
 
    return result;
@@ -1823,6 +2525,11 @@ void XtrnUnltchMPBttn::clrStatus(bool clrIsOn){
 	return;
 }
 
+bool XtrnUnltchMPBttn::_isTmdSttPend(){
+
+	return (_isLatched && (_unLtchBttn != nullptr));	//The unlatch signal comes from another object, not from this object's input edges
+}
+
 void XtrnUnltchMPBttn::stOffNVURP_Do(){
 	if(_validDisablePend){
 		if(_validUnlatchRlsPend)
@@ -1873,30 +2580,6 @@ DblActnLtchMPBttn::~DblActnLtchMPBttn()
 {
 }
 
-bool DblActnLtchMPBttn::begin(const unsigned long int &pollDelayMs) {
-    bool result {false};
-    BaseType_t tmrModResult {pdFAIL};
-
-    if (pollDelayMs > 0){
-        if (!_mpbPollTmrHndl){
-            _mpbPollTmrHndl = xTimerCreate(
-            		_mpbPollTmrName.c_str(),  //Timer name
-                pdMS_TO_TICKS(pollDelayMs),  //Timer period in ticks
-                pdTRUE,     //Auto-reload true
-                this,       //TimerID: data passed to the callback function to work
-                mpbPollCallback	  //Callback function
-				);
-            if (_mpbPollTmrHndl != NULL){
-               tmrModResult = xTimerStart(_mpbPollTmrHndl, portMAX_DELAY);
-            	if (tmrModResult == pdPASS)
-                  result = true;
-            }
-        }
-    }
-
-    return result;
-}
-
 void DblActnLtchMPBttn::clrStatus(bool clrIsOn){
 	taskENTER_CRITICAL();
 	_scndModTmrStrt = 0;
@@ -1925,6 +2608,19 @@ bool DblActnLtchMPBttn::getIsOnScndry(){
 	return _isOnScndry;
 }
 
+const unsigned long int DblActnLtchMPBttn::getNxtDdln() const{
+	unsigned long int result {DbncdMPBttn::getNxtDdln()};
+	unsigned long int scndModDdln {0};
+
+	if(_isEnabled && _isPressed && !_validScndModPend && (_dbncTimerStrt != 0)){
+		scndModDdln = _dbncTimerStrt + ((_xtrnDbncd || _plcyDbncd)?0:_dbncTimeTempSett) + _strtDelay + _scndModActvDly;	//Second mode activation
+		if((result == 0) || (scndModDdln < result))
+			result = scndModDdln;
+	}
+
+	return result;
+}
+
 unsigned long DblActnLtchMPBttn::getScndModActvDly(){
 
 	return _scndModActvDly;
@@ -1935,28 +2631,39 @@ const TaskHandle_t DblActnLtchMPBttn::getTaskWhileOnScndry(){
 	return _taskWhileOnScndryHndl;
 }
 
-void DblActnLtchMPBttn::mpbPollCallback(TimerHandle_t mpbTmrCbArg){
-	DblActnLtchMPBttn* mpbObj = (DblActnLtchMPBttn*)pvTimerGetTimerID(mpbTmrCbArg);
+bool DblActnLtchMPBttn::_isStbl(){
+	/*The _validPressPend and _validReleasePend flags are not considered: the state machine keeps them raised while waiting for the MPB release
+	or for a new press-release cycle, so they're solved by the input changes or by the second mode activation deadline*/
+
+	return (!_sttChng && (_isPressed == _prssRlsCcl) && !_validEnablePend && !_validDisablePend && !_validScndModPend);
+}
+
+bool DblActnLtchMPBttn::_isTmdSttPend(){
+
+	return _isPressed;	//While pressed the second mode activation delay, or the second mode itself, are time driven
+}
+
+void DblActnLtchMPBttn::mpbPollUpd(){
 
 	taskENTER_CRITICAL();
-	if(mpbObj->getIsEnabled()){
+	if(getIsEnabled()){
 		// Input/Output signals update
-		mpbObj->updIsPressed();
+		updIsPressed();
 		// Flags/Triggers calculation & update
-		mpbObj->updValidPressesStatus();
+		updValidPressesStatus();
 	}
  	// State machine state update
-	mpbObj->updFdaState();
+	updFdaState();
 	taskEXIT_CRITICAL();
 
-	if (mpbObj->getOutputsChange()){
-		if(mpbObj->getTaskToNotify() != NULL){
+	if (getOutputsChange()){
+		if(getTaskToNotify() != NULL){
 			xTaskNotify(
-					mpbObj->getTaskToNotify(),	//TaskHandle_t of the task receiving notification
-					static_cast<unsigned long>(mpbObj->getOtptsSttsPkgd()),
+					getTaskToNotify(),	//TaskHandle_t of the task receiving notification
+					static_cast<unsigned long>(getOtptsSttsPkgd()),
 					eSetValueWithOverwrite
 			);
-			mpbObj->setOutputsChange(false);
+			setOutputsChange(false);
 		}
 	}
 
@@ -1984,17 +2691,21 @@ void DblActnLtchMPBttn::setFnWhnTrnOnScndryPtr(void (*newFnWhnTrnOn)()){
 
 bool DblActnLtchMPBttn::setScndModActvDly(const unsigned long &newVal){
 	bool result {true};
+	bool chngd {false};
 
 	taskENTER_CRITICAL();
 	if(newVal != _scndModActvDly){
 		if (newVal >= _MinSrvcTime){  //The minimum activation time is _minActTime
 			_scndModActvDly = newVal;
+			chngd = true;
 		}
 		else{
 			result = false;
 		}
 	}
 	taskEXIT_CRITICAL();
+	if(chngd)
+		_pollWkp();	//The pending deadline, if any, must be recalculated
 
 	return result;
 }
@@ -2241,37 +2952,50 @@ void DblActnLtchMPBttn::updFdaState(){
 }
 
 bool DblActnLtchMPBttn::updValidPressesStatus(){
+	//An input already debounced by the servicing mechanism (see MPBttnPollGrp::setVrtclDbnc(const bool&, const uint8_t&)) or by a debounce policy (see DbncPlcyMPBttn) needs no debouncing time
+	unsigned long int dbncTime {(_xtrnDbncd || _plcyDbncd)?0:_dbncTimeTempSett};
+	unsigned long int dbncRlsTime {(_xtrnDbncd || _plcyDbncd)?0:_dbncRlsTimeTempSett};
+
 	if(_isPressed){
-		if(_dbncRlsTimerStrt != 0)
+		if(_dbncRlsTimerStrt != 0){
 			_dbncRlsTimerStrt = 0;
+			_bncTrnIntr(1, xTaskGetTickCount() / portTICK_RATE_MS);	//Release bounce
+		}
 		if(_dbncTimerStrt == 0){    //It was not previously pressed
 			_dbncTimerStrt = xTaskGetTickCount() / portTICK_RATE_MS;	//Started to be pressed
+			if(!_prssRlsCcl)
+				_bncTrnDtct(0, _dbncTimerStrt, dbncTime);
 		}
-		else{
-			if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncTimerStrt) >= ((_dbncTimeTempSett + _strtDelay) + _scndModActvDly)){
-				_validScndModPend = true;
-				_validPressPend = false;
-			} else if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncTimerStrt) >= (_dbncTimeTempSett + _strtDelay)){
-				_validPressPend = true;
-			}
-			if(_validPressPend || _validScndModPend){
-				_validReleasePend = false;
-				_prssRlsCcl = true;
+		if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncTimerStrt) >= ((dbncTime + _strtDelay) + _scndModActvDly)){
+			_validScndModPend = true;
+			_validPressPend = false;
+		} else if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncTimerStrt) >= (dbncTime + _strtDelay)){
+			_validPressPend = true;
+		}
+		if(_validPressPend || _validScndModPend){
+			_validReleasePend = false;
+			if(!_prssRlsCcl){
+				_lastPrssTmStmp = _edgeTmStmp(_dbncTimerStrt);
+				_bncTrnVldt(0, _dbncTimerStrt);
 			}
+			_prssRlsCcl = true;
 		}
 	}
 	else{
-		if(_dbncTimerStrt != 0)
+		if(_dbncTimerStrt != 0){
 			_dbncTimerStrt = 0;
+			_bncTrnIntr(0, xTaskGetTickCount() / portTICK_RATE_MS);	//Press bounce
+		}
 		if(!_validReleasePend && _prssRlsCcl){
 			if(_dbncRlsTimerStrt == 0){    //It was not previously pressed
 				_dbncRlsTimerStrt = xTaskGetTickCount() / portTICK_RATE_MS;	//Started to be UNpressed
+				_bncTrnDtct(1, _dbncRlsTimerStrt, dbncRlsTime);
 			}
-			else{
-				if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncRlsTimerStrt) >= (_dbncRlsTimeTempSett)){
-					_validReleasePend = true;
-					_prssRlsCcl = false;
-				}
+			if (((xTaskGetTickCount() / portTICK_RATE_MS) - _dbncRlsTimerStrt) >= (dbncRlsTime)){
+				_validReleasePend = true;
+				_prssRlsCcl = false;
+				_lastRlsTmStmp = _edgeTmStmp(_dbncRlsTimerStrt);
+				_bncTrnVldt(1, _dbncRlsTimerStrt);
 			}
 		}
 	}
@@ -2719,29 +3443,33 @@ bool VdblMPBttn::getStOnWhnOtpFrcd(){
 	return _stOnWhnOtptFrcd;
 }
 
-void VdblMPBttn::mpbPollCallback(TimerHandle_t mpbTmrCbArg){
-	VdblMPBttn* mpbObj = (VdblMPBttn*)pvTimerGetTimerID(mpbTmrCbArg);
+bool VdblMPBttn::_isStbl(){
+
+	return (DbncdMPBttn::_isStbl() && (!_validVoidPend || _isVoided) && !_validUnvoidPend);	//Once voided, the void condition is kept until the MPB is released
+}
+
+void VdblMPBttn::mpbPollUpd(){
 
 	taskENTER_CRITICAL();
-	if(mpbObj->getIsEnabled()){
+	if(getIsEnabled()){
 		// Input/Output signals update
-		mpbObj->updIsPressed();
+		updIsPressed();
 		// Flags/Triggers calculation & update
-		mpbObj->updValidPressesStatus();
-		mpbObj->updVoidStatus();
+		updValidPressesStatus();
+		updVoidStatus();
 	}
  	// State machine state update
-	mpbObj->updFdaState();
+	updFdaState();
 	taskEXIT_CRITICAL();
 
-	if (mpbObj->getOutputsChange()){
-		if(mpbObj->getTaskToNotify() != NULL){
+	if (getOutputsChange()){
+		if(getTaskToNotify() != NULL){
 			xTaskNotify(
-					mpbObj->getTaskToNotify(),	//TaskHandle_t of the task receiving notification
-					static_cast<unsigned long>(mpbObj->getOtptsSttsPkgd()),
+					getTaskToNotify(),	//TaskHandle_t of the task receiving notification
+					static_cast<unsigned long>(getOtptsSttsPkgd()),
 					eSetValueWithOverwrite
 			);
-			mpbObj->setOutputsChange(false);
+			setOutputsChange(false);
 		}
 	}
 
@@ -2818,6 +3546,7 @@ bool VdblMPBttn::setVoided(const bool &newVoidValue){
 			_turnOffVdd();
 	}
 	taskEXIT_CRITICAL();
+	_pollWkp();
 
 	return true;
 }
@@ -3084,28 +3813,6 @@ TmVdblMPBttn::~TmVdblMPBttn()
 {
 }
 
-bool TmVdblMPBttn::begin(const unsigned long int &pollDelayMs){
-   bool result {false};
-   BaseType_t tmrModResult {pdFAIL};
-
-   if (!_mpbPollTmrHndl){
-		_mpbPollTmrHndl = xTimerCreate(
-				_mpbPollTmrName.c_str(),  //Timer name
-			pdMS_TO_TICKS(pollDelayMs),  //Timer period in ticks
-			pdTRUE,     //Autoreload true
-			this,       //TimerID: data passed to the callback funtion to work
-			mpbPollCallback
-		);
-	}
-   if (_mpbPollTmrHndl != NULL){
-   	tmrModResult = xTimerStart(_mpbPollTmrHndl, portMAX_DELAY);
-		if (tmrModResult == pdPASS)
-			result = true;
-	}
-
-   return result;
-}
-
 void TmVdblMPBttn::clrStatus(){
 	taskENTER_CRITICAL();
    _voidTmrStrt = 0;
@@ -3115,6 +3822,19 @@ void TmVdblMPBttn::clrStatus(){
    return;
 }
 
+const unsigned long int TmVdblMPBttn::getNxtDdln() const{
+	unsigned long int result {DbncdMPBttn::getNxtDdln()};
+	unsigned long int voidDdln {0};
+
+	if(_isEnabled && !_isVoided && (_voidTmrStrt != 0)){
+		voidDdln = _voidTmrStrt + _voidTime;	//Voiding time end
+		if((result == 0) || (voidDdln < result))
+			result = voidDdln;
+	}
+
+	return result;
+}
+
 const unsigned long int TmVdblMPBttn::getVoidTime() const{
 
     return _voidTime;
@@ -3122,19 +3842,29 @@ const unsigned long int TmVdblMPBttn::getVoidTime() const{
 
 bool TmVdblMPBttn::setVoidTime(const unsigned long int &newVoidTime){
     bool result{true};
+    bool chngd{false};
 
     taskENTER_CRITICAL();
     if(newVoidTime != _voidTime){
-   	 if(newVoidTime >= _MinSrvcTime)
+   	 if(newVoidTime >= _MinSrvcTime){
    		 _voidTime = newVoidTime;
+   		 chngd = true;
+   	 }
    	 else
    		 result = false;
     }
     taskEXIT_CRITICAL();
+    if(chngd)
+   	 _pollWkp();	//The pending deadline, if any, must be recalculated
 
     return result;
 }
 
+bool TmVdblMPBttn::_isTmdSttPend(){
+
+	return ((_voidTmrStrt != 0) && !_isVoided);	//The voiding time is running
+}
+
 void TmVdblMPBttn::stOffNotVPP_In(){
 	_voidTmrStrt = 0;
 
@@ -3192,50 +3922,1954 @@ SnglSrvcVdblMPBttn::~SnglSrvcVdblMPBttn()
 {
 }
 
-bool SnglSrvcVdblMPBttn::begin(const unsigned long int &pollDelayMs){
-   bool result {false};
-   BaseType_t tmrModResult {pdFAIL};
+void SnglSrvcVdblMPBttn::setTaskWhileOn(const TaskHandle_t &newTaskHandle){
+
+	return;
+}
+
+void SnglSrvcVdblMPBttn::stOffVddNVUP_Do(){
+	if(_validReleasePend){
+		_validReleasePend = false;
+		_validUnvoidPend = true;
+	}
+
+	return;
+}
+
+bool SnglSrvcVdblMPBttn::updVoidStatus(){
+	bool result {false};
+
+	if(_isOn)
+		result = true;
+	_validVoidPend = result;
+
+	return _validVoidPend;
+}
+
+//=========================================================================> Class methods delimiter
+
+MPBttnInptSrc::MPBttnInptSrc()
+{
+	_inptSrcMtx = xSemaphoreCreateMutex();
+}
+
+MPBttnInptSrc::~MPBttnInptSrc(){
+	if(_inptSrcMtx != NULL){
+		vSemaphoreDelete(_inptSrcMtx);
+		_inptSrcMtx = NULL;
+	}
+}
+
+const unsigned long int MPBttnInptSrc::getRfrshsCnt() const{
+
+	return _rfrshsCnt;
+}
+
+bool MPBttnInptSrc::rfrsh(const bool &frcRfrsh){
+	bool result {false};
+	TickType_t curTck {xTaskGetTickCount()};
+
+	//A refresh in progress from another task is not waited for, the values it gets are as fresh as needed
+	if((_inptSrcMtx != NULL) && (xSemaphoreTake(_inptSrcMtx, 0) == pdTRUE)){
+		if(frcRfrsh || !_rfrshd || (curTck != _rfrshTck)){
+			result = _rdInpts();
+			if(result){
+				_rfrshTck = curTck;
+				_rfrshd = true;
+				++_rfrshsCnt;
+			}
+		}
+		else{
+			result = true;
+		}
+		xSemaphoreGive(_inptSrcMtx);
+	}
+
+	return result;
+}
+
+//=========================================================================> Class methods delimiter
+
+LpbckInptSrc::LpbckInptSrc(const uint16_t &inptsQty)
+{
+	_inptsBuff.resize((inptsQty + 7) / 8, 0);
+	_inptsLvls.resize((inptsQty + 7) / 8, 0);
+	_inptsQty = inptsQty;
+}
+
+LpbckInptSrc::~LpbckInptSrc(){
+}
+
+bool LpbckInptSrc::getInptLvl(const uint16_t &inptId) const{
+
+	return (inptId < _inptsQty)?((_inptsBuff[inptId / 8] & (1 << (inptId % 8))) != 0):false;
+}
+
+const uint16_t LpbckInptSrc::getInptsQty() const{
+
+	return _inptsQty;
+}
+
+bool LpbckInptSrc::_rdInpts(){
+	taskENTER_CRITICAL();
+	_inptsBuff = _inptsLvls;
+	taskEXIT_CRITICAL();
+
+	return true;
+}
+
+bool LpbckInptSrc::setInptLvl(const uint16_t &inptId, const bool &newInptLvl){
+	bool result {false};
+
+	if(inptId < _inptsQty){
+		taskENTER_CRITICAL();
+		if(newInptLvl)
+			_inptsLvls[inptId / 8] |= (1 << (inptId % 8));
+		else
+			_inptsLvls[inptId / 8] &= ~(1 << (inptId % 8));
+		taskEXIT_CRITICAL();
+		result = true;
+	}
+
+	return result;
+}
+
+//=========================================================================> Class methods delimiter
+
+ShftRgstrInptSrc::ShftRgstrInptSrc(SPI_HandleTypeDef* spiHndl, gpioPinId_t ldPin, const uint8_t &chipsQty, const bool &useDma)
+:_ldPin{ldPin}, _spiHndl{spiHndl}, _useDma{useDma}
+{
+	GPIO_InitTypeDef GPIO_InitStruct {0};
+
+	_inptsBuff.resize(chipsQty, 0);
+	_rxBuff.resize(chipsQty, 0);
+	_inptsQty = chipsQty * 8;
+
+	//The SH/LD pin is kept high (shift mode) between loads
+	HAL_GPIO_WritePin(_ldPin.portId, _ldPin.pinNum, GPIO_PIN_SET);
+	GPIO_InitStruct.Pin = _ldPin.pinNum;
+	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+	HAL_GPIO_Init(_ldPin.portId, &GPIO_InitStruct);
+}
+
+ShftRgstrInptSrc::~ShftRgstrInptSrc(){
+}
+
+bool ShftRgstrInptSrc::getInptLvl(const uint16_t &inptId) const{
+
+	return (inptId < _inptsQty)?((_inptsBuff[inptId / 8] & (1 << (inptId % 8))) != 0):false;
+}
+
+const uint16_t ShftRgstrInptSrc::getInptsQty() const{
+
+	return _inptsQty;
+}
+
+bool ShftRgstrInptSrc::_rdInpts(){
+	bool result {false};
+
+	if((_spiHndl != NULL) && !_rxBuff.empty()){
+		if(_useDma){
+			//The transfer started by the previous refresh is collected, and the next one started, the values lag one refresh behind
+			if(HAL_SPI_GetState(_spiHndl) == HAL_SPI_STATE_READY){
+				if(_dmaRxPend){
+					_inptsBuff = _rxBuff;
+					_dmaRxPend = false;
+					result = true;
+				}
+				_ldInpts();
+				if(HAL_SPI_Receive_DMA(_spiHndl, _rxBuff.data(), _rxBuff.size()) == HAL_OK)
+					_dmaRxPend = true;
+			}
+		}
+		else{
+			_ldInpts();
+			if(HAL_SPI_Receive(_spiHndl, _rxBuff.data(), _rxBuff.size(), _spiTmOut) == HAL_OK){
+				_inptsBuff = _rxBuff;
+				result = true;
+			}
+		}
+	}
+
+	return result;
+}
+
+void ShftRgstrInptSrc::_ldInpts(){
+	//A low pulse in the SH/LD pin latches the parallel inputs of all the chained registers
+	HAL_GPIO_WritePin(_ldPin.portId, _ldPin.pinNum, GPIO_PIN_RESET);
+	HAL_GPIO_WritePin(_ldPin.portId, _ldPin.pinNum, GPIO_PIN_SET);
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+I2cXpndrInptSrc::I2cXpndrInptSrc(I2C_HandleTypeDef* i2cHndl, const uint8_t &devAddr, const bool &regBsd, const uint8_t &inptsQty, gpioPinId_t intPin)
+:_devAddr{devAddr}, _i2cHndl{i2cHndl}, _intPin{intPin}, _regBsd{regBsd}
+{
+	GPIO_InitTypeDef GPIO_InitStruct {0};
+
+	_inptsQty = (inptsQty > 8)?16:8;
+	if((_intPin.portId != NULL) && (_intPin.pinNum != _InvalidPinNum)){
+		//The INT line is active low, open drain for the register-less expanders and configured as open drain for the register based ones
+		GPIO_InitStruct.Pin = _intPin.pinNum;
+		GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+		GPIO_InitStruct.Pull = GPIO_PULLUP;
+		HAL_GPIO_Init(_intPin.portId, &GPIO_InitStruct);
+		_hasInt = true;
+	}
+}
+
+I2cXpndrInptSrc::~I2cXpndrInptSrc(){
+}
+
+bool I2cXpndrInptSrc::begin(){
+	bool result {true};
+	uint8_t cnfgBuff[2] {0xFF, 0xFF};
+
+	if(_regBsd){
+		cnfgBuff[0] = 0x44;	//IOCON: MIRROR (INTA and INTB internally connected) and ODR (INT open drain) set, sequential addressing
+		result = _xpndrWr(_mcpIoconRegAddr, cnfgBuff, 1);
+		cnfgBuff[0] = 0xFF;
+		if(result)
+			result = _xpndrWr(_mcpGppuRegAddr, cnfgBuff, _inptsQty / 8);	//Pull-ups enabled
+		if(result)
+			result = _xpndrWr(_mcpGpintenRegAddr, cnfgBuff, _inptsQty / 8);	//Interrupt on change enabled, compared against the previous value
+	}
+	else{
+		result = _xpndrWr(0, cnfgBuff, _inptsQty / 8);	//Quasi-bidirectional pins must be written high to be used as inputs
+	}
+	if(result){
+		_intPend = true;
+		result = rfrsh(true);
+	}
+
+	return result;
+}
+
+const unsigned long int I2cXpndrInptSrc::getBusTrnsctnsCnt() const{
+
+	return _busTrnsctnsCnt;
+}
+
+bool I2cXpndrInptSrc::getInptLvl(const uint16_t &inptId) const{
+
+	return (inptId < _inptsQty)?((_inptsLvls & (1 << inptId)) != 0):false;
+}
+
+const uint16_t I2cXpndrInptSrc::getInptsQty() const{
+
+	return _inptsQty;
+}
+
+bool I2cXpndrInptSrc::_isIntActv(){
+
+	return HAL_GPIO_ReadPin(_intPin.portId, _intPin.pinNum) == GPIO_PIN_RESET;
+}
+
+bool I2cXpndrInptSrc::_rdInpts(){
+	bool result {true};
+	uint8_t rdBuff[2] {0xFF, 0xFF};
+
+	//With an INT line the bus is kept idle until the expander signals an input change
+	if(!_hasInt || _intPend || _isIntActv()){
+		_intPend = false;	//Cleared before the read, an INT activation during the read is served by the next refresh
+		result = _xpndrRd(rdBuff, _inptsQty / 8);
+		if(result)
+			_inptsLvls = rdBuff[0] | (rdBuff[1] << 8);
+		else
+			_intPend = true;	//The read is retried by the next refresh
+	}
+
+	return result;
+}
+
+void I2cXpndrInptSrc::xpndrIntCallback(){
+	_intPend = true;
+
+	return;
+}
+
+bool I2cXpndrInptSrc::_xpndrRd(uint8_t* rdBuff, const uint8_t &rdQty){
+	HAL_StatusTypeDef rdRslt {HAL_ERROR};
+
+	if(_i2cHndl != NULL){
+		if(_regBsd)
+			rdRslt = HAL_I2C_Mem_Read(_i2cHndl, _devAddr << 1, _mcpGpioRegAddr, I2C_MEMADD_SIZE_8BIT, rdBuff, rdQty, _i2cTmOut);	//Reading the GPIO registers clears the INT line
+		else
+			rdRslt = HAL_I2C_Master_Receive(_i2cHndl, _devAddr << 1, rdBuff, rdQty, _i2cTmOut);
+		++_busTrnsctnsCnt;
+	}
+
+	return rdRslt == HAL_OK;
+}
+
+bool I2cXpndrInptSrc::_xpndrWr(const uint8_t &regAddr, uint8_t* wrBuff, const uint8_t &wrQty){
+	HAL_StatusTypeDef wrRslt {HAL_ERROR};
+
+	if(_i2cHndl != NULL){
+		if(_regBsd)
+			wrRslt = HAL_I2C_Mem_Write(_i2cHndl, _devAddr << 1, regAddr, I2C_MEMADD_SIZE_8BIT, wrBuff, wrQty, _i2cTmOut);
+		else
+			wrRslt = HAL_I2C_Master_Transmit(_i2cHndl, _devAddr << 1, wrBuff, wrQty, _i2cTmOut);
+		++_busTrnsctnsCnt;
+	}
+
+	return wrRslt == HAL_OK;
+}
+
+//=========================================================================> Class methods delimiter
+
+SimI2cXpndrInptSrc::SimI2cXpndrInptSrc(const uint8_t &inptsQty)
+:I2cXpndrInptSrc(NULL, 0x20, true, inptsQty)
+{
+	_hasInt = true;
+}
+
+SimI2cXpndrInptSrc::~SimI2cXpndrInptSrc(){
+}
+
+bool SimI2cXpndrInptSrc::_isIntActv(){
+
+	return _simInt;
+}
+
+bool SimI2cXpndrInptSrc::setInptLvl(const uint16_t &inptId, const bool &newInptLvl){
+	bool result {false};
+	uint16_t prvLvls {0};
+
+	if(inptId < _inptsQty){
+		taskENTER_CRITICAL();
+		prvLvls = _simLvls;
+		if(newInptLvl)
+			_simLvls |= (1 << inptId);
+		else
+			_simLvls &= ~(1 << inptId);
+		if(_simLvls != prvLvls)
+			_simInt = true;
+		taskEXIT_CRITICAL();
+		result = true;
+	}
+
+	return result;
+}
+
+bool SimI2cXpndrInptSrc::_xpndrRd(uint8_t* rdBuff, const uint8_t &rdQty){
+	taskENTER_CRITICAL();
+	rdBuff[0] = _simLvls & 0xFF;
+	if(rdQty > 1)
+		rdBuff[1] = _simLvls >> 8;
+	_simInt = false;	//The bulk read clears the simulated INT line
+	taskEXIT_CRITICAL();
+	++_busTrnsctnsCnt;
+
+	return true;
+}
+
+bool SimI2cXpndrInptSrc::_xpndrWr(const uint8_t &regAddr, uint8_t* wrBuff, const uint8_t &wrQty){
+	++_busTrnsctnsCnt;
+
+	return true;
+}
+
+//=========================================================================> Class methods delimiter
+
+KeyMtrxInptSrc::KeyMtrxInptSrc(gpioPinId_t* rowsPins, const uint8_t &rowsQty, GPIO_TypeDef* colsPort, const uint16_t &colsPinsMsk, const bool &hasDiodes)
+:_colsPort{colsPort}, _hasDiodes{hasDiodes}
+{
+	GPIO_InitTypeDef GPIO_InitStruct {0};
+
+	for(uint8_t pinNum{0}; (pinNum < 16) && (_colsQty < _mtrxMaxLns); ++pinNum){
+		if(colsPinsMsk & (1 << pinNum))
+			_colsPinNum[_colsQty++] = pinNum;
+	}
+	if(rowsPins != nullptr){
+		for(uint8_t row{0}; (row < rowsQty) && (row < _mtrxMaxLns); ++row)
+			_rowsPins[_rowsQty++] = rowsPins[row];
+	}
+
+	if(_colsPort != NULL){
+		/*Configure GPIO pins : columns, as inputs pulled up*/
+		GPIO_InitStruct.Pin = colsPinsMsk;
+		GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+		GPIO_InitStruct.Pull = GPIO_PULLUP;
+		HAL_GPIO_Init(_colsPort, &GPIO_InitStruct);
+	}
+	for(uint8_t row{0}; row < _rowsQty; ++row){
+		/*Configure GPIO pins : rows, as open drain outputs released (high)*/
+		HAL_GPIO_WritePin(_rowsPins[row].portId, _rowsPins[row].pinNum, GPIO_PIN_SET);
+		GPIO_InitStruct.Pin = _rowsPins[row].pinNum;
+		GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_OD;
+		GPIO_InitStruct.Pull = GPIO_NOPULL;
+		GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+		HAL_GPIO_Init(_rowsPins[row].portId, &GPIO_InitStruct);
+	}
+}
+
+KeyMtrxInptSrc::~KeyMtrxInptSrc(){
+}
+
+const uint8_t KeyMtrxInptSrc::getColsQty() const{
+
+	return _colsQty;
+}
+
+const bool KeyMtrxInptSrc::getGhstngDtctd() const{
+
+	return _ghstngDtctd;
+}
+
+const unsigned long int KeyMtrxInptSrc::getGhstngCnt() const{
+
+	return _ghstngCnt;
+}
+
+bool KeyMtrxInptSrc::getInptLvl(const uint16_t &inptId) const{
+	bool result {true};
+
+	if(inptId < (_rowsQty * _colsQty))
+		result = ((_keysPrssd[inptId / _colsQty] & (1 << (inptId % _colsQty))) == 0);	//A pressed key reads as a low level
+
+	return result;
+}
+
+const uint16_t KeyMtrxInptSrc::getInptsQty() const{
+
+	return _rowsQty * _colsQty;
+}
+
+const uint8_t KeyMtrxInptSrc::getRowsQty() const{
+
+	return _rowsQty;
+}
+
+bool KeyMtrxInptSrc::_rdInpts(){
+	uint8_t keysRd[_mtrxMaxLns]{};
+	uint8_t ghstMsk[_mtrxMaxLns]{};
+	uint8_t shrdCols {0};
+
+	for(uint8_t row{0}; row < _rowsQty; ++row)
+		keysRd[row] = _rdRowCols(row);
+
+	if(!_hasDiodes){
+		//Two rows sharing two or more pressed columns build a rectangle whose keys can't be told from ghost keys
+		_ghstngDtctd = false;
+		for(uint8_t row{0}; row < _rowsQty; ++row){
+			for(uint8_t othrRow{(uint8_t)(row + 1)}; othrRow < _rowsQty; ++othrRow){
+				shrdCols = keysRd[row] & keysRd[othrRow];
+				if(shrdCols & (shrdCols - 1)){	//More than one bit set
+					ghstMsk[row] |= shrdCols;
+					ghstMsk[othrRow] |= shrdCols;
+					_ghstngDtctd = true;
+				}
+			}
+		}
+		if(_ghstngDtctd)
+			++_ghstngCnt;
+	}
+	for(uint8_t row{0}; row < _rowsQty; ++row)
+		_keysPrssd[row] = (keysRd[row] & ~ghstMsk[row]) | (_keysPrssd[row] & ghstMsk[row]);
+
+	return true;
+}
+
+uint8_t KeyMtrxInptSrc::_rdRowCols(const uint8_t &row){
+	uint8_t result {0};
+	uint32_t colsRd {0};
+
+	HAL_GPIO_WritePin(_rowsPins[row].portId, _rowsPins[row].pinNum, GPIO_PIN_RESET);
+	for(volatile uint8_t sttlLp{0}; sttlLp < _sttlLps; ++sttlLp){
+	}
+	colsRd = ~(_colsPort->IDR);	//A single port read for all the columns, pressed keys read low
+	HAL_GPIO_WritePin(_rowsPins[row].portId, _rowsPins[row].pinNum, GPIO_PIN_SET);
+
+	for(uint8_t col{0}; col < _colsQty; ++col){
+		if(colsRd & (1 << _colsPinNum[col]))
+			result |= (1 << col);
+	}
+
+	return result;
+}
+
+void KeyMtrxInptSrc::setSttlLps(const uint8_t &newSttlLps){
+	_sttlLps = newSttlLps;
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+SimKeyMtrxInptSrc::SimKeyMtrxInptSrc(const uint8_t &rowsQty, const uint8_t &colsQty, const bool &hasDiodes)
+:KeyMtrxInptSrc(nullptr, 0, NULL, 0, hasDiodes)
+{
+	_rowsQty = (rowsQty < _mtrxMaxLns)?rowsQty:_mtrxMaxLns;
+	_colsQty = (colsQty < _mtrxMaxLns)?colsQty:_mtrxMaxLns;
+}
+
+SimKeyMtrxInptSrc::~SimKeyMtrxInptSrc(){
+}
+
+uint8_t SimKeyMtrxInptSrc::_rdRowCols(const uint8_t &row){
+	uint8_t result {0};
+	uint8_t rchdRows {0};
+	uint8_t prvRchdRows {0};
+
+	taskENTER_CRITICAL();
+	if(_hasDiodes){
+		result = _simKeysPrssd[row];
+	}
+	else{
+		//With no diodes the pressed keys connect the driven row to other rows, and those rows to their pressed columns
+		rchdRows = 1 << row;
+		while(rchdRows != prvRchdRows){
+			prvRchdRows = rchdRows;
+			for(uint8_t othrRow{0}; othrRow < _rowsQty; ++othrRow){
+				if(rchdRows & (1 << othrRow))
+					result |= _simKeysPrssd[othrRow];
+			}
+			for(uint8_t othrRow{0}; othrRow < _rowsQty; ++othrRow){
+				if(_simKeysPrssd[othrRow] & result)
+					rchdRows |= (1 << othrRow);
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return result;
+}
+
+bool SimKeyMtrxInptSrc::setKeyPrssd(const uint8_t &row, const uint8_t &col, const bool &newKeyPrssd){
+	bool result {false};
+
+	if((row < _rowsQty) && (col < _colsQty)){
+		taskENTER_CRITICAL();
+		if(newKeyPrssd)
+			_simKeysPrssd[row] |= (1 << col);
+		else
+			_simKeysPrssd[row] &= ~(1 << col);
+		taskEXIT_CRITICAL();
+		result = true;
+	}
+
+	return result;
+}
+
+//=========================================================================> Class methods delimiter
+
+AdcLddrInptSrc::AdcLddrInptSrc(ADC_HandleTypeDef* adcHndl, const uint16_t &smplsBuffLen)
+:_adcHndl{adcHndl}
+{
+	_smplsBuff.resize((smplsBuffLen > 0)?smplsBuffLen:1, 0xFFFF);	//Buffer initialized to the idle line level of a pulled up ladder
+}
+
+AdcLddrInptSrc::~AdcLddrInptSrc(){
+	end();
+}
+
+bool AdcLddrInptSrc::addWndw(const uint16_t &lowLmt, const uint16_t &hghLmt){
+	bool result {false};
+
+	if((lowLmt <= hghLmt) && (_wndwsQty < _wndwsMaxQty)){
+		result = true;
+		for(uint8_t wndw{0}; wndw < _wndwsQty; ++wndw){
+			if((lowLmt <= _wndwsHghLmt[wndw]) && (hghLmt >= _wndwsLowLmt[wndw]))
+				result = false;
+		}
+		if(result){
+			taskENTER_CRITICAL();
+			_wndwsLowLmt[_wndwsQty] = lowLmt;
+			_wndwsHghLmt[_wndwsQty] = hghLmt;
+			++_wndwsQty;
+			taskEXIT_CRITICAL();
+		}
+	}
+
+	return result;
+}
+
+bool AdcLddrInptSrc::begin(){
+	bool result {false};
+
+	if(_adcHndl != NULL)
+		result = (HAL_ADC_Start_DMA(_adcHndl, reinterpret_cast<uint32_t*>(_smplsBuff.data()), _smplsBuff.size()) == HAL_OK);
+
+	return result;
+}
+
+bool AdcLddrInptSrc::end(){
+	bool result {true};
+
+	if(_adcHndl != NULL)
+		result = (HAL_ADC_Stop_DMA(_adcHndl) == HAL_OK);
+
+	return result;
+}
+
+void AdcLddrInptSrc::feedSmplsBtch(const uint16_t* smplsBtch, const std::size_t &smplsQty){
+	if(smplsBtch != nullptr){
+		taskENTER_CRITICAL();
+		for(std::size_t smplNum{0}; (smplNum < smplsQty) && (smplNum < _smplsBuff.size()); ++smplNum)
+			_smplsBuff[smplNum] = smplsBtch[smplNum];
+		taskEXIT_CRITICAL();
+	}
+
+	return;
+}
+
+const uint16_t AdcLddrInptSrc::getBtchMean() const{
+
+	return _btchMean;
+}
+
+bool AdcLddrInptSrc::getInptLvl(const uint16_t &inptId) const{
+
+	return inptId != _actvWndw;	//The active window input reads as a low level
+}
+
+const uint16_t AdcLddrInptSrc::getInptsQty() const{
+
+	return _wndwsQty;
+}
+
+bool AdcLddrInptSrc::_rdInpts(){
+	uint32_t smplsSum {0};
+	uint8_t nxtActvWndw {_noActvWndw};
+
+	//The buffer might be written by the DMA while read, the mean of a mix of two batches is as valid as the mean of one
+	for(std::size_t smplNum{0}; smplNum < _smplsBuff.size(); ++smplNum)
+		smplsSum += _smplsBuff[smplNum];
+	_btchMean = smplsSum / _smplsBuff.size();
+
+	if((_actvWndw != _noActvWndw) &&
+			(_btchMean + _hyst >= _wndwsLowLmt[_actvWndw]) &&
+			(_btchMean <= (uint32_t)(_wndwsHghLmt[_actvWndw]) + _hyst)){
+		nxtActvWndw = _actvWndw;	//The active window keeps active inside the hysteresis band
+	}
+	else{
+		for(uint8_t wndw{0}; wndw < _wndwsQty; ++wndw){
+			if((_btchMean >= _wndwsLowLmt[wndw]) && (_btchMean <= _wndwsHghLmt[wndw])){
+				nxtActvWndw = wndw;
+				break;
+			}
+		}
+	}
+	_actvWndw = nxtActvWndw;
+
+	return true;
+}
+
+void AdcLddrInptSrc::setHyst(const uint16_t &newHyst){
+	_hyst = newHyst;
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MPBttnTmrWhl::MPBttnTmrWhl()
+{
+}
+
+MpbTmrWhlNd_t* MPBttnTmrWhl::advance(const unsigned long int &newCurTm){
+	MpbTmrWhlNd_t* expdLst {nullptr};
+	MpbTmrWhlNd_t* nxtNd {nullptr};
+	MpbTmrWhlNd_t* whlNd {nullptr};
+	uint8_t whlSlot {0};
+
+	if(!_curTmSet || (_ndsQty == 0)){
+		//Nothing to expire in the time elapsed, the wheel time is just moved
+		_curTm = newCurTm;
+		_curTmSet = true;
+	}
+	else{
+		while(static_cast<long int>(newCurTm - _curTm) > 0){
+			++_curTm;
+			whlSlot = _curTm & (_whlSlots - 1);
+			if(whlSlot == 0){
+				//Lower level wrapped around, the upper levels slots for the new time range are cascaded down, the highest level first
+				if(((_curTm >> _whlSlotBits) & (_whlSlots - 1)) == 0)
+					_cscdSlot(2, (_curTm >> (2 * _whlSlotBits)) & (_whlSlots - 1));
+				_cscdSlot(1, (_curTm >> _whlSlotBits) & (_whlSlots - 1));
+			}
+			whlNd = _whlSlotsLst[0][whlSlot];
+			_whlSlotsLst[0][whlSlot] = nullptr;
+			while(whlNd != nullptr){
+				nxtNd = whlNd->next;
+				whlNd->lnkd = false;
+				--_ndsQty;
+				if(static_cast<long int>(whlNd->expTm - _curTm) <= 0){
+					whlNd->prev = nullptr;
+					whlNd->next = expdLst;
+					expdLst = whlNd;
+				}
+				else{
+					_lnkNd(whlNd);
+				}
+				whlNd = nxtNd;
+			}
+			if(_ndsQty == 0)
+				_curTm = newCurTm;
+		}
+	}
+
+	return expdLst;
+}
+
+void MPBttnTmrWhl::cancel(MpbTmrWhlNd_t* whlNd){
+	if((whlNd != nullptr) && whlNd->lnkd){
+		if(whlNd->prev != nullptr)
+			whlNd->prev->next = whlNd->next;
+		else
+			_whlSlotsLst[whlNd->whlLvl][whlNd->whlSlot] = whlNd->next;
+		if(whlNd->next != nullptr)
+			whlNd->next->prev = whlNd->prev;
+		whlNd->prev = nullptr;
+		whlNd->next = nullptr;
+		whlNd->lnkd = false;
+		--_ndsQty;
+	}
+
+	return;
+}
+
+void MPBttnTmrWhl::_cscdSlot(const uint8_t &whlLvl, const uint8_t &whlSlot){
+	MpbTmrWhlNd_t* nxtNd {nullptr};
+	MpbTmrWhlNd_t* whlNd {_whlSlotsLst[whlLvl][whlSlot]};
+
+	_whlSlotsLst[whlLvl][whlSlot] = nullptr;
+	while(whlNd != nullptr){
+		nxtNd = whlNd->next;
+		whlNd->lnkd = false;
+		--_ndsQty;
+		_lnkNd(whlNd);
+		whlNd = nxtNd;
+	}
+
+	return;
+}
+
+const unsigned long int MPBttnTmrWhl::getCurTm() const{
+
+	return _curTm;
+}
+
+const std::size_t MPBttnTmrWhl::getNdsQty() const{
+
+	return _ndsQty;
+}
+
+void MPBttnTmrWhl::_lnkNd(MpbTmrWhlNd_t* whlNd){
+	unsigned long int dltTm {0};
+	unsigned long int slotTm {whlNd->expTm};
+
+	if(static_cast<long int>(whlNd->expTm - _curTm) > 0)
+		dltTm = whlNd->expTm - _curTm;
+	else
+		slotTm = _curTm;	//Already due, expires in the slot being processed
+	if(dltTm < _whlSlots){
+		whlNd->whlLvl = 0;
+		whlNd->whlSlot = slotTm & (_whlSlots - 1);
+	}
+	else if(dltTm < (1UL << (2 * _whlSlotBits))){
+		whlNd->whlLvl = 1;
+		whlNd->whlSlot = (slotTm >> _whlSlotBits) & (_whlSlots - 1);
+	}
+	else{
+		//Deadlines beyond the wheel range are kept in the furthest slot, and relinked when it's cascaded
+		if(dltTm >= (1UL << (3 * _whlSlotBits)))
+			slotTm = _curTm + (1UL << (3 * _whlSlotBits)) - 1;
+		whlNd->whlLvl = 2;
+		whlNd->whlSlot = (slotTm >> (2 * _whlSlotBits)) & (_whlSlots - 1);
+	}
+	whlNd->prev = nullptr;
+	whlNd->next = _whlSlotsLst[whlNd->whlLvl][whlNd->whlSlot];
+	if(whlNd->next != nullptr)
+		whlNd->next->prev = whlNd;
+	_whlSlotsLst[whlNd->whlLvl][whlNd->whlSlot] = whlNd;
+	whlNd->lnkd = true;
+	++_ndsQty;
+
+	return;
+}
+
+void MPBttnTmrWhl::schedule(MpbTmrWhlNd_t* whlNd, const unsigned long int &expTm){
+	if(whlNd != nullptr){
+		cancel(whlNd);
+		//A deadline already due must not land in the slot of the current wheel time, already processed
+		if(static_cast<long int>(expTm - _curTm) > 0)
+			whlNd->expTm = expTm;
+		else
+			whlNd->expTm = _curTm + 1;
+		_lnkNd(whlNd);
+	}
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MPBttnPollGrp::MPBttnPollGrp(const std::string &pollGrpName)
+:_pollGrpTmrName{pollGrpName + "_tmr"}
+{
+	_mpbsLstMtx = xSemaphoreCreateMutex();
+}
+
+MPBttnPollGrp::~MPBttnPollGrp(){
+	end();
+	if(_mpbsLstMtx != NULL)
+		xSemaphoreTake(_mpbsLstMtx, portMAX_DELAY);
+	for(DbncdMPBttn* mpbObj : _mpbsLst){
+		_tmrWhl.cancel(&(mpbObj->_tmrWhlNd));
+		_dtchPortSnpsht(mpbObj);
+		mpbObj->_tmrWhlDrmnt = false;
+		mpbObj->_mpbPollGrp = nullptr;
+	}
+	_mpbsLst.clear();
+	_inptSrcsLst.clear();
+	if(_mpbsLstMtx != NULL){
+		xSemaphoreGive(_mpbsLstMtx);
+		vSemaphoreDelete(_mpbsLstMtx);
+		_mpbsLstMtx = NULL;
+	}
+}
+
+bool MPBttnPollGrp::addMPBttn(DbncdMPBttn* mpbObj, const uint8_t &lanePrty){
+	bool result {false};
+	std::vector<DbncdMPBttn*>::iterator mpbIt {};
+
+	if((mpbObj != nullptr) && (_mpbsLstMtx != NULL) && (lanePrty < _pollLanesQty)){
+		if(mpbObj->_mpbPollGrp == this){
+			result = true;
+		}
+		else if((mpbObj->_mpbPollGrp == nullptr) && (mpbObj->_mpbPollTmrHndl == NULL) && !mpbObj->_edgeTrgrd){
+			if(xSemaphoreTake(_mpbsLstMtx, portMAX_DELAY) == pdTRUE){
+				//The list is kept ordered by lane priority, the highest priority lane at the head of the list
+				mpbIt = _mpbsLst.begin();
+				while((mpbIt != _mpbsLst.end()) && ((*mpbIt)->_pollLanePrty >= lanePrty))
+					++mpbIt;
+				mpbObj->_pollPhs = (lanePrty == 0)?_lstLdStggrdPhs():0;
+				_mpbsLst.insert(mpbIt, mpbObj);
+				mpbObj->_pollLanePrty = lanePrty;
+				if(_portsSnpshtEnbld)
+					_attchPortSnpsht(mpbObj);
+				_attchInptSrc(mpbObj);
+				mpbObj->_tmrWhlDrmnt = false;
+				mpbObj->_mpbPollGrp = this;
+				xSemaphoreGive(_mpbsLstMtx);
+				result = true;
+			}
+		}
+	}
+
+	return result;
+}
+
+void MPBttnPollGrp::_attchInptSrc(DbncdMPBttn* mpbObj){
+	//Each distinct input source of the registered objects is kept once, to be refreshed once per scan
+	if(mpbObj->_inptSrc != nullptr){
+		for(MpbInptSrcRef_t &inptSrcRef : _inptSrcsLst){
+			if(inptSrcRef.inptSrc == mpbObj->_inptSrc){
+				++inptSrcRef.mpbsQty;
+				return;
+			}
+		}
+		_inptSrcsLst.push_back(MpbInptSrcRef_t{mpbObj->_inptSrc, 1});
+	}
+
+	return;
+}
+
+void MPBttnPollGrp::_attchPortSnpsht(DbncdMPBttn* mpbObj){
+	uint8_t freeSlot {_snpshtPortsMax};
+
+	if((mpbObj->_portSnpsht == nullptr) && (mpbObj->_inptSrc == nullptr) && (mpbObj->_mpbttnPort != NULL)){
+		for(uint8_t portSlot {0}; portSlot < _snpshtPortsMax; ++portSlot){
+			if((_portsSnpsht[portSlot].mpbsQty > 0) && (_portsSnpsht[portSlot].port == mpbObj->_mpbttnPort)){
+				freeSlot = portSlot;
+				break;
+			}
+			if((_portsSnpsht[portSlot].mpbsQty == 0) && (freeSlot == _snpshtPortsMax))
+				freeSlot = portSlot;
+		}
+		if(freeSlot < _snpshtPortsMax){	//With no slot available the object keeps reading it's own pin
+			if(_portsSnpsht[freeSlot].mpbsQty == 0){
+				_portsSnpsht[freeSlot].port = mpbObj->_mpbttnPort;
+				_portsSnpsht[freeSlot].invMsk = 0;
+			}
+			_portsSnpsht[freeSlot].invMsk |= mpbObj->_prssdLvlInvMsk;
+			//The object's pin starts from it's present level, with it's vertical counter cleared
+			_portsSnpsht[freeSlot].idr = (_portsSnpsht[freeSlot].idr & ~((uint32_t)mpbObj->_mpbttnPin)) | (((_portsSnpsht[freeSlot].port->IDR) ^ _portsSnpsht[freeSlot].invMsk) & mpbObj->_mpbttnPin);
+			for(uint32_t &vrtclCntrBit : _portsSnpsht[freeSlot].vrtclCntr)
+				vrtclCntrBit &= ~((uint32_t)mpbObj->_mpbttnPin);
+			++_portsSnpsht[freeSlot].mpbsQty;
+			mpbObj->_portSnpsht = &(_portsSnpsht[freeSlot].idr);
+			mpbObj->_xtrnDbncd = _vrtclDbnc;
+		}
+	}
+
+	return;
+}
+
+bool MPBttnPollGrp::begin(const unsigned long int &pollDelayMs){
+	bool result {false};
+	BaseType_t tmrModResult {pdFAIL};
+
+	if ((pollDelayMs > 0) && (_pollGrpTaskHndl == NULL)){
+		if (!_pollGrpTmrHndl){
+			_setScanPrd(pollDelayMs);
+			resetPollPrdStts();
+			resetPollTckLd();
+			resetLanesLtncy();
+			_pollGrpTmrHndl = xTimerCreate(
+					_pollGrpTmrName.c_str(),  //Timer name
+				_scanPrdTcks,  //Timer period in ticks
+				pdTRUE,     //Auto-reload true
+				this,       //TimerID: data passed to the callback function to work
+				pollGrpCallback
+			);
+			if (_pollGrpTmrHndl != NULL){
+				tmrModResult = xTimerStart(_pollGrpTmrHndl, portMAX_DELAY);
+				if (tmrModResult == pdPASS)
+					result = true;
+			}
+		}
+		else{
+			result = true;
+		}
+	}
+
+	return result;
+}
+
+bool MPBttnPollGrp::beginTask(const unsigned long int &pollDelayMs, const UBaseType_t &taskPrty, const configSTACK_DEPTH_TYPE &stackDepth){
+	bool result {false};
+	BaseType_t taskCrtResult {pdFAIL};
+
+	if ((pollDelayMs > 0) && (_pollGrpTmrHndl == NULL)){
+		if (!_pollGrpTaskHndl){
+			_setScanPrd(pollDelayMs);
+			resetPollPrdStts();
+			resetPollTckLd();
+			resetLanesLtncy();
+			taskCrtResult = xTaskCreate(
+				pollGrpTask,	//Task function
+				_pollGrpTmrName.c_str(),	//Task name
+				stackDepth,	//Stack depth in words
+				this,	//Parameter passed to the task function
+				taskPrty,	//Task priority
+				&_pollGrpTaskHndl
+			);
+			if (taskCrtResult == pdPASS)
+				result = true;
+			else
+				_pollGrpTaskHndl = NULL;
+		}
+		else{
+			result = true;
+		}
+	}
+
+	return result;
+}
+
+void MPBttnPollGrp::_dtchInptSrc(DbncdMPBttn* mpbObj){
+	if(mpbObj->_inptSrc != nullptr){
+		for(std::vector<MpbInptSrcRef_t>::iterator inptSrcIt = _inptSrcsLst.begin(); inptSrcIt != _inptSrcsLst.end(); ++inptSrcIt){
+			if(inptSrcIt->inptSrc == mpbObj->_inptSrc){
+				if(--(inptSrcIt->mpbsQty) == 0)
+					_inptSrcsLst.erase(inptSrcIt);
+				break;
+			}
+		}
+	}
+
+	return;
+}
+
+void MPBttnPollGrp::_dtchPortSnpsht(DbncdMPBttn* mpbObj){
+	for(uint8_t portSlot {0}; portSlot < _snpshtPortsMax; ++portSlot){
+		if(mpbObj->_portSnpsht == &(_portsSnpsht[portSlot].idr)){
+			--_portsSnpsht[portSlot].mpbsQty;
+			_portsSnpsht[portSlot].invMsk &= ~((uint32_t)mpbObj->_mpbttnPin);
+			break;
+		}
+	}
+	mpbObj->_portSnpsht = nullptr;
+	mpbObj->_xtrnDbncd = false;
+
+	return;
+}
+
+bool MPBttnPollGrp::end(){
+	bool result {true};
+	BaseType_t tmrModResult {pdFAIL};
+
+	if (_pollGrpTaskHndl){
+		//The list mutex is taken to ensure the task is not deleted in the middle of a scan, holding the mutex
+		xSemaphoreTake(_mpbsLstMtx, portMAX_DELAY);
+		vTaskDelete(_pollGrpTaskHndl);
+		_pollGrpTaskHndl = NULL;
+		_pausePend = false;
+		xSemaphoreGive(_mpbsLstMtx);
+	}
+	if (_pollGrpTmrHndl){
+		tmrModResult = xTimerStop(_pollGrpTmrHndl, portMAX_DELAY);
+		if (tmrModResult == pdPASS){
+			tmrModResult = xTimerDelete(_pollGrpTmrHndl, portMAX_DELAY);
+			if (tmrModResult == pdPASS)
+				_pollGrpTmrHndl = NULL;
+			else
+				result = false;
+		}
+		else{
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+const std::size_t MPBttnPollGrp::getLastScanUpdsQty() const{
+
+	return _scanUpdsQty;
+}
+
+const unsigned long int MPBttnPollGrp::getLastScanInptRdsQty() const{
+
+	return _scanInptRdsQty;
+}
+
+MpbPollLaneLtncy_t MPBttnPollGrp::getLaneLtncy(const uint8_t &lanePrty){
+	MpbPollLaneLtncy_t result {0};
+	unsigned long int cycsPerUs {SystemCoreClock / 1000000};
+
+	if(lanePrty < _pollLanesQty){
+		result.lanePrty = lanePrty;
+		if(xSemaphoreTake(_mpbsLstMtx, portMAX_DELAY) == pdTRUE){
+			for(DbncdMPBttn* mpbObj : _mpbsLst){
+				if(mpbObj->_pollLanePrty == lanePrty)
+					++result.mpbsQty;
+			}
+			xSemaphoreGive(_mpbsLstMtx);
+		}
+		taskENTER_CRITICAL();
+		result.scansCnt = _laneScansCnt[lanePrty];
+		result.scanPosMaxUs = _laneScanPosMaxCycs[lanePrty] / cycsPerUs;
+		if(_laneScansCnt[lanePrty] > 0)
+			result.scanPosMeanUs = static_cast<unsigned long int>((_laneScanPosSumCycs[lanePrty] / _laneScansCnt[lanePrty]) / cycsPerUs);
+		result.prssCnt = _lanePrssCnt[lanePrty];
+		result.prssLtncyMaxUs = _lanePrssLtncyMaxUs[lanePrty];
+		if(_lanePrssCnt[lanePrty] > 0)
+			result.prssLtncyMeanUs = static_cast<unsigned long int>(_lanePrssLtncySumUs[lanePrty] / _lanePrssCnt[lanePrty]);
+		taskEXIT_CRITICAL();
+	}
+
+	return result;
+}
+
+const std::size_t MPBttnPollGrp::getMPBttnsQty() const{
+
+	return _mpbsLst.size();
+}
+
+const unsigned long int MPBttnPollGrp::getPollDelay() const{
+
+	return _pollDelay;
+}
+
+MpbPollPrdStts_t MPBttnPollGrp::getPollPrdStts(){
+	MpbPollPrdStts_t result {0};
+
+	taskENTER_CRITICAL();
+	result.prdsCnt = _prdsCnt;
+	result.prdMinUs = _prdMinUs;
+	result.prdMaxUs = _prdMaxUs;
+	if(_prdsCnt > 0)
+		result.prdMeanUs = static_cast<unsigned long int>(_prdsSumUs / _prdsCnt);
+	taskEXIT_CRITICAL();
+
+	return result;
+}
+
+const bool MPBttnPollGrp::getPortsSnpsht() const{
+
+	return _portsSnpshtEnbld;
+}
+
+MpbPollTckLd_t MPBttnPollGrp::getPollTckLd(){
+	MpbPollTckLd_t result {0};
+
+	taskENTER_CRITICAL();
+	result.scansCnt = _tckLdScansCnt;
+	result.srvcdMin = _tckLdMin;
+	result.srvcdMax = _tckLdMax;
+	if(_tckLdScansCnt > 0)
+		result.srvcdMean = static_cast<unsigned long int>(_tckLdSum / _tckLdScansCnt);
+	taskEXIT_CRITICAL();
+
+	return result;
+}
+
+const bool MPBttnPollGrp::getStggrd() const{
+
+	return _stggrd;
+}
+
+const bool MPBttnPollGrp::getVrtclDbnc() const{
+
+	return _vrtclDbnc;
+}
+
+std::size_t MPBttnPollGrp::_lstLdStggrdPhs(){
+	std::size_t result {0};
+	std::vector<std::size_t> phsLd(_stggrdPhsQty, 0);
+
+	for(DbncdMPBttn* mpbObj : _mpbsLst){
+		if((mpbObj->_pollLanePrty == 0) && (mpbObj->_pollPhs < _stggrdPhsQty))
+			++phsLd[mpbObj->_pollPhs];
+	}
+	for(std::size_t phs {1}; phs < _stggrdPhsQty; ++phs){
+		if(phsLd[phs] < phsLd[result])
+			result = phs;
+	}
+
+	return result;
+}
+
+bool MPBttnPollGrp::pause(){
+	bool result {false};
+
+	if (_pollGrpTaskHndl){
+		_pausePend = true;	//Honoured by the poller task between scans, never while holding the objects list mutex
+		result = true;
+	}
+	else if (_pollGrpTmrHndl){
+		if (xTimerStop(_pollGrpTmrHndl, portMAX_DELAY) == pdPASS)
+			result = true;
+	}
+	_prdSttsRsync = true;	//The time spent paused is not a scan period
+
+	return result;
+}
+
+void MPBttnPollGrp::pollGrpCallback(TimerHandle_t pollGrpTmrCbArg){
+	MPBttnPollGrp* pollGrpObj = (MPBttnPollGrp*)pvTimerGetTimerID(pollGrpTmrCbArg);
+
+	pollGrpObj->_updPrdStts();
+	pollGrpObj->scanMPBttns();
+
+	return;
+}
+
+void MPBttnPollGrp::pollGrpTask(void* pollGrpTaskArg){
+	MPBttnPollGrp* pollGrpObj = (MPBttnPollGrp*)pollGrpTaskArg;
+	TickType_t lastWkTm {xTaskGetTickCount()};
+
+	for(;;){
+		while(pollGrpObj->_pausePend){
+			pollGrpObj->_prdSttsRsync = true;
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);	//Paused between scans until resume() notifies
+		}
+		if(pollGrpObj->_prdSttsRsync)
+			lastWkTm = xTaskGetTickCount();	//After a pause the period is restarted, no catching up of the missed scans
+		vTaskDelayUntil(&lastWkTm, pollGrpObj->_scanPrdTcks);
+		if(!pollGrpObj->_pausePend){
+			pollGrpObj->_updPrdStts();
+			pollGrpObj->scanMPBttns();
+		}
+	}
+}
+
+void MPBttnPollGrp::resetPollPrdStts(){
+	//Enable the cycles counter used to measure the periods, no harm done if it was already enabled
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	taskENTER_CRITICAL();
+	_prdsCnt = 0;
+	_prdMinUs = 0;
+	_prdMaxUs = 0;
+	_prdsSumUs = 0;
+	_prdSttsRsync = true;
+	taskEXIT_CRITICAL();
+
+	return;
+}
+
+void MPBttnPollGrp::resetPollTckLd(){
+	taskENTER_CRITICAL();
+	_tckLdScansCnt = 0;
+	_tckLdMin = 0;
+	_tckLdMax = 0;
+	_tckLdSum = 0;
+	taskEXIT_CRITICAL();
+
+	return;
+}
+
+void MPBttnPollGrp::resetLanesLtncy(){
+	//Enable the cycles counter used to measure the latencies, no harm done if it was already enabled
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	taskENTER_CRITICAL();
+	for(uint8_t lanePrty {0}; lanePrty < _pollLanesQty; ++lanePrty){
+		_lanePrssCnt[lanePrty] = 0;
+		_lanePrssLtncyMaxUs[lanePrty] = 0;
+		_lanePrssLtncySumUs[lanePrty] = 0;
+		_laneScansCnt[lanePrty] = 0;
+		_laneScanPosMaxCycs[lanePrty] = 0;
+		_laneScanPosSumCycs[lanePrty] = 0;
+	}
+	taskEXIT_CRITICAL();
+
+	return;
+}
+
+bool MPBttnPollGrp::resume(){
+	bool result {false};
+
+	_prdSttsRsync = true;
+	if (_pollGrpTaskHndl){
+		_pausePend = false;
+		xTaskNotifyGive(_pollGrpTaskHndl);
+		result = true;
+	}
+	else if (_pollGrpTmrHndl){
+		if (xTimerStart(_pollGrpTmrHndl, portMAX_DELAY) == pdPASS)
+			result = true;
+	}
+
+	return result;
+}
+
+bool MPBttnPollGrp::rmvMPBttn(DbncdMPBttn* mpbObj){
+	bool result {false};
+
+	if((mpbObj != nullptr) && (mpbObj->_mpbPollGrp == this) && (_mpbsLstMtx != NULL)){
+		if(xSemaphoreTake(_mpbsLstMtx, portMAX_DELAY) == pdTRUE){
+			for(std::vector<DbncdMPBttn*>::iterator mpbIt = _mpbsLst.begin(); mpbIt != _mpbsLst.end(); ++mpbIt){
+				if(*mpbIt == mpbObj){
+					_mpbsLst.erase(mpbIt);
+					_tmrWhl.cancel(&(mpbObj->_tmrWhlNd));
+					_dtchPortSnpsht(mpbObj);
+					_dtchInptSrc(mpbObj);
+					mpbObj->_tmrWhlDrmnt = false;
+					mpbObj->_mpbPollGrp = nullptr;
+					result = true;
+					break;
+				}
+			}
+			xSemaphoreGive(_mpbsLstMtx);
+		}
+	}
+
+	return result;
+}
+
+void MPBttnPollGrp::_setScanPrd(const unsigned long int &pollDelayMs){
+	_pollDelay = pollDelayMs;
+	if(_stggrd){
+		//A scan every tick, the poll period ticks become the phases
+		_scanPrdTcks = 1;
+		_setStggrdPhsQty(pdMS_TO_TICKS(pollDelayMs));
+	}
+	else{
+		_scanPrdTcks = pdMS_TO_TICKS(pollDelayMs);
+		if(_scanPrdTcks == 0)
+			_scanPrdTcks = 1;
+		_setStggrdPhsQty(1);
+	}
+
+	return;
+}
+
+void MPBttnPollGrp::_setStggrdPhsQty(const std::size_t &phsQty){
+	std::size_t phs {0};
+
+	_stggrdPhsQty = (phsQty > 0)?phsQty:1;
+	_stggrdPhs = 0;
+	if((_mpbsLstMtx != NULL) && (xSemaphoreTake(_mpbsLstMtx, portMAX_DELAY) == pdTRUE)){
+		//The ordinary lane objects are distributed evenly through the phases, each object keeps it's phase until removed
+		for(DbncdMPBttn* mpbObj : _mpbsLst){
+			if(mpbObj->_pollLanePrty == 0){
+				mpbObj->_pollPhs = phs;
+				if(++phs >= _stggrdPhsQty)
+					phs = 0;
+			}
+		}
+		xSemaphoreGive(_mpbsLstMtx);
+	}
+
+	return;
+}
+
+bool MPBttnPollGrp::setPortsSnpsht(const bool &newPortsSnpsht){
+	bool result {true};
+
+	if(newPortsSnpsht != _portsSnpshtEnbld){
+		if(xSemaphoreTake(_mpbsLstMtx, portMAX_DELAY) == pdTRUE){
+			_portsSnpshtEnbld = newPortsSnpsht;
+			for(DbncdMPBttn* mpbObj : _mpbsLst){
+				if(_portsSnpshtEnbld)
+					_attchPortSnpsht(mpbObj);
+				else
+					_dtchPortSnpsht(mpbObj);
+			}
+			xSemaphoreGive(_mpbsLstMtx);
+		}
+		else{
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+bool MPBttnPollGrp::setVrtclDbnc(const bool &newVrtclDbnc, const uint8_t &dbncCntrBits){
+	bool result {false};
+
+	if((dbncCntrBits > 0) && (dbncCntrBits <= _vrtclCntrBitsMax)){
+		if(xSemaphoreTake(_mpbsLstMtx, portMAX_DELAY) == pdTRUE){
+			if((newVrtclDbnc != _vrtclDbnc) || (dbncCntrBits != _vrtclCntrBits)){
+				//The counters are restarted, the debounced levels are kept
+				for(MpbPortSnpsht_t &portSnpsht : _portsSnpsht){
+					for(uint32_t &vrtclCntrBit : portSnpsht.vrtclCntr)
+						vrtclCntrBit = 0;
+				}
+				_vrtclCntrBits = dbncCntrBits;
+				_vrtclDbnc = newVrtclDbnc;
+				for(DbncdMPBttn* mpbObj : _mpbsLst){
+					if(mpbObj->_portSnpsht != nullptr)
+						mpbObj->_xtrnDbncd = _vrtclDbnc;
+				}
+			}
+			xSemaphoreGive(_mpbsLstMtx);
+			result = true;
+		}
+	}
+
+	return result;
+}
+
+bool MPBttnPollGrp::setStggrd(const bool &newStggrd){
+	bool result {true};
+
+	if(newStggrd != _stggrd){
+		if((_pollGrpTmrHndl == NULL) && (_pollGrpTaskHndl == NULL) && !_rtSchdlrActv)
+			_stggrd = newStggrd;
+		else
+			result = false;
+	}
+
+	return result;
+}
+
+void MPBttnPollGrp::_updPrdStts(){
+	uint32_t curCycCnt {DWT->CYCCNT};
+	unsigned long int prdUs {0};
+
+	taskENTER_CRITICAL();
+	if(_prdSttsRsync){
+		//First scan after a start, pause or reset, there's no valid previous scan to measure the period from
+		_prdSttsRsync = false;
+	}
+	else{
+		prdUs = static_cast<unsigned long int>((curCycCnt - _prdLastCycCnt) / (SystemCoreClock / 1000000));
+		if((_prdsCnt == 0) || (prdUs < _prdMinUs))
+			_prdMinUs = prdUs;
+		if(prdUs > _prdMaxUs)
+			_prdMaxUs = prdUs;
+		_prdsSumUs += prdUs;
+		++_prdsCnt;
+	}
+	_prdLastCycCnt = curCycCnt;
+	taskEXIT_CRITICAL();
 
-   if (!_mpbPollTmrHndl){
-		_mpbPollTmrHndl = xTimerCreate(
-				_mpbPollTmrName.c_str(),  //Timer name
-			pdMS_TO_TICKS(pollDelayMs),  //Timer period in ticks
-			pdTRUE,     //Autoreload true
-			this,       //TimerID: data passed to the callback funtion to work
-			mpbPollCallback
-		);
-	}
-   if (_mpbPollTmrHndl != NULL){
-   	tmrModResult = xTimerStart(_mpbPollTmrHndl, portMAX_DELAY);
-		if (tmrModResult == pdPASS)
-			result = true;
+	return;
+}
+
+void MPBttnPollGrp::scanMPBttns(){
+	MpbTmrWhlNd_t* expdNd {nullptr};
+	uint8_t lanePrty {0};
+	std::size_t mpbIdx {0};
+	uint32_t scanStrtCycCnt {DWT->CYCCNT};
+	unsigned long int scanStrtMs {xTaskGetTickCount() / portTICK_RATE_MS};
+	unsigned long int scanSrvcdQty {0};
+	std::size_t scanUpdsQty {0};
+
+	//The scan is executed in the timer daemon task context, it must never block waiting for the list mutex
+	if(xSemaphoreTake(_mpbsLstMtx, 0) == pdTRUE){
+		//The objects whose deadline expired are woken up
+		expdNd = _tmrWhl.advance(scanStrtMs);
+		while(expdNd != nullptr){
+			expdNd->mpbObj->_tmrWhlDrmnt = false;
+			expdNd = expdNd->next;
+		}
+		//Each port with registered objects is read once, all it's objects are sampled at the same instant, and all their pins polarity normalized in a single operation
+		_inptRdsCntr = 0;
+		for(MpbPortSnpsht_t &portSnpsht : _portsSnpsht){
+			if(portSnpsht.mpbsQty > 0){
+				if(_vrtclDbnc)
+					_updVrtclDbnc(portSnpsht, (portSnpsht.port->IDR) ^ portSnpsht.invMsk);
+				else
+					portSnpsht.idr = (portSnpsht.port->IDR) ^ portSnpsht.invMsk;
+				++_inptRdsCntr;
+			}
+		}
+		//Each input source with registered objects is refreshed once, before any of it's objects, dormant or not, reads it's input level
+		for(MpbInptSrcRef_t &inptSrcRef : _inptSrcsLst)
+			inptSrcRef.inptSrc->rfrsh();
+		//The priority lanes objects, at the head of the list, are serviced in every scan, from the highest priority lane down
+		while((mpbIdx < _mpbsLst.size()) && (_mpbsLst[mpbIdx]->_pollLanePrty > 0)){
+			lanePrty = _mpbsLst[mpbIdx]->_pollLanePrty;
+			while((mpbIdx < _mpbsLst.size()) && (_mpbsLst[mpbIdx]->_pollLanePrty == lanePrty)){
+				if(_srvcMPBttn(_mpbsLst[mpbIdx], scanStrtMs, scanStrtCycCnt))
+					++scanUpdsQty;
+				++scanSrvcdQty;
+				++mpbIdx;
+			}
+			_updLaneScanPos(lanePrty, DWT->CYCCNT - scanStrtCycCnt);
+		}
+		//Only the ordinary lane objects of the current phase are serviced, with no staggering there's a single phase holding all the objects
+		for(; mpbIdx < _mpbsLst.size(); ++mpbIdx){
+			if(_mpbsLst[mpbIdx]->_pollPhs == _stggrdPhs){
+				if(_srvcMPBttn(_mpbsLst[mpbIdx], scanStrtMs, scanStrtCycCnt))
+					++scanUpdsQty;
+				++scanSrvcdQty;
+			}
+		}
+		_updLaneScanPos(0, DWT->CYCCNT - scanStrtCycCnt);
+		_scanUpdsQty = scanUpdsQty;
+		_scanInptRdsQty = _inptRdsCntr;
+		if(++_stggrdPhs >= _stggrdPhsQty)
+			_stggrdPhs = 0;
+
+		taskENTER_CRITICAL();
+		if((_tckLdScansCnt == 0) || (scanSrvcdQty < _tckLdMin))
+			_tckLdMin = scanSrvcdQty;
+		if(scanSrvcdQty > _tckLdMax)
+			_tckLdMax = scanSrvcdQty;
+		_tckLdSum += scanSrvcdQty;
+		++_tckLdScansCnt;
+		taskEXIT_CRITICAL();
+		xSemaphoreGive(_mpbsLstMtx);
 	}
 
-   return result;
+	return;
 }
 
-void SnglSrvcVdblMPBttn::setTaskWhileOn(const TaskHandle_t &newTaskHandle){
+bool MPBttnPollGrp::_srvcMPBttn(DbncdMPBttn* mpbObj, const unsigned long int &scanStrtMs, const uint32_t &scanStrtCycCnt){
+	bool prvPrssRlsCcl {false};
+	uint32_t prvOtptsStts {0};
+	unsigned long int nxtDdln {0};
+
+	if((mpbObj->_inptSrc == nullptr) && (mpbObj->_portSnpsht == nullptr) && !mpbObj->_xtrnSmplng)
+		++_inptRdsCntr;	//The object reads it's own pin
+	if(mpbObj->_tmrWhlDrmnt){
+		/*A dormant object only gets it's input read, an input change wakes it up. The input is read with no state updated (i.e. a debounce policy state),
+		the sample is processed once, by the object's update*/
+		if(mpbObj->_rdIsPressed() == mpbObj->_isPressed)
+			return false;
+		mpbObj->_tmrWhlDrmnt = false;
+	}
+	_tmrWhl.cancel(&(mpbObj->_tmrWhlNd));
+	//The outputs are only compared while a press may be validated or a validated press has not changed them yet
+	prvPrssRlsCcl = mpbObj->_prssRlsCcl;
+	if(!prvPrssRlsCcl || mpbObj->_prssLtncyPend)
+		prvOtptsStts = mpbObj->_otptsSttsPkg();
+	mpbObj->mpbPollUpd();
+	if(!prvPrssRlsCcl && mpbObj->_prssRlsCcl){
+		//The press was validated in this service, the due time is the first detection time plus the debounce time and the start delay
+		mpbObj->_prssLtncyDdln = mpbObj->_dbncTimerStrt + ((mpbObj->_xtrnDbncd || mpbObj->_plcyDbncd)?0:mpbObj->_dbncTimeTempSett) + mpbObj->_strtDelay;
+		mpbObj->_prssLtncyPend = true;
+	}
+	if(mpbObj->_prssLtncyPend){
+		if(mpbObj->_otptsSttsPkg() != prvOtptsStts){
+			//A press due after the scan start (the tick advanced during the scan) is measured from the scan start
+			_updLanePrssLtncy(mpbObj->_pollLanePrty, ((scanStrtMs > mpbObj->_prssLtncyDdln)?((scanStrtMs - mpbObj->_prssLtncyDdln) * 1000):0) + ((DWT->CYCCNT - scanStrtCycCnt) / (SystemCoreClock / 1000000)));
+			mpbObj->_prssLtncyPend = false;
+		}
+		else if(!mpbObj->_prssRlsCcl){
+			mpbObj->_prssLtncyPend = false;	//Released without changing the outputs, i.e. a disabled object
+		}
+	}
+
+	taskENTER_CRITICAL();
+	if(mpbObj->_isStbl()){
+		nxtDdln = mpbObj->getNxtDdln();
+		if(nxtDdln != 0){
+			_tmrWhl.schedule(&(mpbObj->_tmrWhlNd), nxtDdln);
+			mpbObj->_tmrWhlDrmnt = true;
+		}
+		else if(!mpbObj->_isTmdSttPend()){
+			mpbObj->_tmrWhlDrmnt = true;
+		}
+		//A timed state with no deadline to wait for (i.e. depending on another object) keeps the object updated every scan
+	}
+	taskEXIT_CRITICAL();
+
+	return true;
+}
+
+void MPBttnPollGrp::_updVrtclDbnc(MpbPortSnpsht_t &portSnpsht, const uint32_t &portSmpl){
+	/*Bit-sliced vertical counters: bit n of each vrtclCntr word is a bit of the counter of pin n, so all the port pins are counted at once.
+	A pin's counter is incremented on each sample differing from it's debounced level and cleared on each sample equal to it,
+	the carry out of the counter's last bit marks the pins whose level differed for 2^_vrtclCntrBits consecutive samples*/
+	uint32_t smplDiff {portSmpl ^ portSnpsht.idr};
+	uint32_t cntrCarry {smplDiff};
+	uint32_t nxtCarry {0};
+
+	for(uint8_t cntrBit {0}; cntrBit < _vrtclCntrBits; ++cntrBit){
+		nxtCarry = portSnpsht.vrtclCntr[cntrBit] & cntrCarry;
+		portSnpsht.vrtclCntr[cntrBit] = (portSnpsht.vrtclCntr[cntrBit] ^ cntrCarry) & smplDiff;
+		cntrCarry = nxtCarry;
+	}
+	portSnpsht.idr ^= cntrCarry;	//The edges mask toggles the debounced levels
 
 	return;
 }
 
-void SnglSrvcVdblMPBttn::stOffVddNVUP_Do(){
-	if(_validReleasePend){
-		_validReleasePend = false;
-		_validUnvoidPend = true;
+void MPBttnPollGrp::_updLanePrssLtncy(const uint8_t &lanePrty, const unsigned long int &ltncyUs){
+	taskENTER_CRITICAL();
+	if(ltncyUs > _lanePrssLtncyMaxUs[lanePrty])
+		_lanePrssLtncyMaxUs[lanePrty] = ltncyUs;
+	_lanePrssLtncySumUs[lanePrty] += ltncyUs;
+	++_lanePrssCnt[lanePrty];
+	taskEXIT_CRITICAL();
+
+	return;
+}
+
+void MPBttnPollGrp::_updLaneScanPos(const uint8_t &lanePrty, const uint32_t &scanPosCycs){
+	taskENTER_CRITICAL();
+	if(scanPosCycs > _laneScanPosMaxCycs[lanePrty])
+		_laneScanPosMaxCycs[lanePrty] = scanPosCycs;
+	_laneScanPosSumCycs[lanePrty] += scanPosCycs;
+	++_laneScansCnt[lanePrty];
+	taskEXIT_CRITICAL();
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MPBttnDmaSmplr::MPBttnDmaSmplr(GPIO_TypeDef* smplPort, const unsigned long int &smplFreqHz, const std::size_t &smplsBuffLen, const std::string &smplrName)
+:MPBttnPollGrp(smplrName), _smplPort{smplPort}, _smplFreqHz{smplFreqHz}
+{
+	_portsSnpshtEnbld = false;	//The pins levels are provided by the sampled batches
+	if(_smplFreqHz == 0)
+		_smplFreqHz = 1;
+	_smplsBuff.resize((smplsBuffLen / 2) * 2, 0);	//Must be split in two equal halves
+}
+
+MPBttnDmaSmplr::~MPBttnDmaSmplr(){
+	end();
+	if(_mpbsLstMtx != NULL)
+		xSemaphoreTake(_mpbsLstMtx, portMAX_DELAY);
+	for(DbncdMPBttn* mpbObj : _mpbsLst)
+		mpbObj->_xtrnSmplng = false;
+	if(_mpbsLstMtx != NULL)
+		xSemaphoreGive(_mpbsLstMtx);
+}
+
+bool MPBttnDmaSmplr::addMPBttn(DbncdMPBttn* mpbObj, const uint8_t &lanePrty){
+	bool result {false};
+
+	if((mpbObj != nullptr) && (mpbObj->_mpbttnPort == _smplPort)){
+		if(mpbObj->_mpbPollGrp == nullptr){
+			//The object starts from the present pin level, until the first batch is fed
+			mpbObj->_xtrnPinLvl = (HAL_GPIO_ReadPin(mpbObj->_mpbttnPort, mpbObj->_mpbttnPin) == GPIO_PIN_SET);
+			mpbObj->_xtrnPinLvlChng = false;
+		}
+		result = MPBttnPollGrp::addMPBttn(mpbObj, lanePrty);
+		if(result)
+			mpbObj->_xtrnSmplng = true;
+	}
+
+	return result;
+}
+
+bool MPBttnDmaSmplr::begin(TIM_HandleTypeDef* smplTmrHndl, DMA_HandleTypeDef* smplDmaHndl){
+	bool result {false};
+
+	if(_smplDmaHndl != NULL){
+		result = true;
+	}
+	else if((smplTmrHndl != NULL) && (smplDmaHndl != NULL) && (_smplsBuff.size() >= 2)){
+		resetPollPrdStts();
+		resetPollTckLd();
+		resetLanesLtncy();
+		smplDmaHndl->Parent = this;
+		smplDmaHndl->XferHalfCpltCallback = smplDmaHlfCpltCallback;
+		smplDmaHndl->XferCpltCallback = smplDmaCpltCallback;
+		if(HAL_DMA_Start_IT(smplDmaHndl, (uint32_t)&(_smplPort->IDR), (uint32_t)_smplsBuff.data(), _smplsBuff.size()) == HAL_OK){
+			__HAL_TIM_ENABLE_DMA(smplTmrHndl, TIM_DMA_UPDATE);
+			if(HAL_TIM_Base_Start(smplTmrHndl) == HAL_OK){
+				_smplTmrHndl = smplTmrHndl;
+				_smplDmaHndl = smplDmaHndl;
+				result = true;
+			}
+			else{
+				__HAL_TIM_DISABLE_DMA(smplTmrHndl, TIM_DMA_UPDATE);
+				HAL_DMA_Abort(smplDmaHndl);
+			}
+		}
+	}
+
+	return result;
+}
+
+bool MPBttnDmaSmplr::end(){
+	bool result {MPBttnPollGrp::end()};
+
+	if(_smplDmaHndl != NULL){
+		if(HAL_TIM_Base_Stop(_smplTmrHndl) != HAL_OK)
+			result = false;
+		__HAL_TIM_DISABLE_DMA(_smplTmrHndl, TIM_DMA_UPDATE);
+		if(HAL_DMA_Abort(_smplDmaHndl) == HAL_OK){
+			_smplDmaHndl = NULL;
+			_smplTmrHndl = NULL;
+		}
+		else{
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+void MPBttnDmaSmplr::feedSmplsBtch(const uint16_t* smplsBtch, const std::size_t &smplsQty){
+	unsigned long int btchEndTm {xTaskGetTickCount() / portTICK_RATE_MS};
+	std::size_t chngIdx {0};
+	unsigned long int chngAge {0};
+	bool lastLvl {false};
+
+	if((smplsBtch != nullptr) && (smplsQty > 0)){
+		_updPrdStts();
+		if(xSemaphoreTake(_mpbsLstMtx, 0) == pdTRUE){
+			for(DbncdMPBttn* mpbObj : _mpbsLst){
+				//Only the last level change of the batch is relevant, the debounce is restarted from it
+				lastLvl = ((smplsBtch[smplsQty - 1] & mpbObj->_mpbttnPin) != 0);
+				chngIdx = smplsQty - 1;
+				while((chngIdx > 0) && (((smplsBtch[chngIdx - 1] & mpbObj->_mpbttnPin) != 0) == lastLvl))
+					--chngIdx;
+				if((chngIdx > 0) || (lastLvl != mpbObj->_xtrnPinLvl)){
+					chngAge = static_cast<unsigned long int>(((smplsQty - 1 - chngIdx) * 1000UL) / _smplFreqHz);
+					taskENTER_CRITICAL();
+					mpbObj->_xtrnPinLvl = lastLvl;
+					mpbObj->_xtrnPinLvlTm = (chngAge < btchEndTm)?(btchEndTm - chngAge):1;	//0 is reserved as the "timer not started" value
+					mpbObj->_xtrnPinLvlChng = true;
+					taskEXIT_CRITICAL();
+				}
+			}
+			xSemaphoreGive(_mpbsLstMtx);
+			++_btchsCnt;
+			scanMPBttns();
+		}
+		else{
+			++_btchsLstCnt;
+		}
 	}
 
 	return;
 }
 
-bool SnglSrvcVdblMPBttn::updVoidStatus(){
+const unsigned long int MPBttnDmaSmplr::getBtchsCnt() const{
+
+	return _btchsCnt;
+}
+
+const unsigned long int MPBttnDmaSmplr::getBtchsLstCnt() const{
+
+	return _btchsLstCnt;
+}
+
+bool MPBttnDmaSmplr::pause(){
 	bool result {false};
 
-	if(_isOn)
+	if(_smplTmrHndl != NULL){
+		if(HAL_TIM_Base_Stop(_smplTmrHndl) == HAL_OK)
+			result = true;
+	}
+	_prdSttsRsync = true;	//The time spent paused is not a batch period
+
+	return result;
+}
+
+bool MPBttnDmaSmplr::resume(){
+	bool result {false};
+
+	_prdSttsRsync = true;
+	if(_smplTmrHndl != NULL){
+		if(HAL_TIM_Base_Start(_smplTmrHndl) == HAL_OK)
+			result = true;
+	}
+
+	return result;
+}
+
+bool MPBttnDmaSmplr::rmvMPBttn(DbncdMPBttn* mpbObj){
+	bool result {MPBttnPollGrp::rmvMPBttn(mpbObj)};
+
+	if(result)
+		mpbObj->_xtrnSmplng = false;
+
+	return result;
+}
+
+void MPBttnDmaSmplr::smplDmaCpltCallback(DMA_HandleTypeDef* smplDmaHndl){
+	MPBttnDmaSmplr* smplrObj = (MPBttnDmaSmplr*)(smplDmaHndl->Parent);
+	BaseType_t xHigherPriorityTaskWoken {pdFALSE};
+
+	//The second half of the buffer is filled, the DMA goes on over the first half while it's processed
+	if(xTimerPendFunctionCallFromISR(smplsBtchPrcss, smplrObj, 1, &xHigherPriorityTaskWoken) != pdPASS)
+		++(smplrObj->_btchsLstCnt);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+
+	return;
+}
+
+void MPBttnDmaSmplr::smplDmaHlfCpltCallback(DMA_HandleTypeDef* smplDmaHndl){
+	MPBttnDmaSmplr* smplrObj = (MPBttnDmaSmplr*)(smplDmaHndl->Parent);
+	BaseType_t xHigherPriorityTaskWoken {pdFALSE};
+
+	//The first half of the buffer is filled, the DMA goes on over the second half while it's processed
+	if(xTimerPendFunctionCallFromISR(smplsBtchPrcss, smplrObj, 0, &xHigherPriorityTaskWoken) != pdPASS)
+		++(smplrObj->_btchsLstCnt);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+
+	return;
+}
+
+void MPBttnDmaSmplr::smplsBtchPrcss(void* smplrArg, uint32_t smplsBuffHlf){
+	MPBttnDmaSmplr* smplrObj = (MPBttnDmaSmplr*)smplrArg;
+	std::size_t btchLen {smplrObj->_smplsBuff.size() / 2};
+
+	smplrObj->feedSmplsBtch(smplrObj->_smplsBuff.data() + (smplsBuffHlf * btchLen), btchLen);
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MPBttnRtSchdlr::MPBttnRtSchdlr(const std::string &schdlrName)
+:_schdlrName{schdlrName}
+{
+	_schdlrMtx = xSemaphoreCreateMutex();
+}
+
+MPBttnRtSchdlr::~MPBttnRtSchdlr(){
+	end();
+	for(MpbRtGrp_t &rtGrp : _rtGrpsLst)
+		delete rtGrp.rtGrp;
+	_rtGrpsLst.clear();
+	if(_schdlrMtx != NULL){
+		vSemaphoreDelete(_schdlrMtx);
+		_schdlrMtx = NULL;
+	}
+}
+
+bool MPBttnRtSchdlr::addMPBttn(DbncdMPBttn* mpbObj, const unsigned long int &rtMs, const uint8_t &lanePrty){
+	bool result {false};
+	MpbRtGrp_t* rtGrpPtr {_getRtGrp(rtMs)};
+	MPBttnPollGrp* newRtGrp {nullptr};
+	std::vector<MpbRtGrp_t>::iterator rtGrpIt {};
+
+	if(rtGrpPtr != nullptr){
+		result = rtGrpPtr->rtGrp->addMPBttn(mpbObj, lanePrty);
+	}
+	else if((rtMs > 0) && (_schdlrTaskHndl == NULL)){
+		//The rate group is only created if it accepts the object, an empty rate group would be left in the list
+		newRtGrp = new MPBttnPollGrp(_schdlrName + "_" + std::to_string(rtMs));
+		result = newRtGrp->addMPBttn(mpbObj, lanePrty);
+		if(result){
+			//The rate groups list is kept ordered from the fastest to the slowest rate, the scanning order in each tick
+			rtGrpIt = _rtGrpsLst.begin();
+			while((rtGrpIt != _rtGrpsLst.end()) && (rtGrpIt->rtMs < rtMs))
+				++rtGrpIt;
+			_rtGrpsLst.insert(rtGrpIt, MpbRtGrp_t{newRtGrp, rtMs, 0, 0, 0, 0});
+		}
+		else{
+			delete newRtGrp;
+		}
+	}
+
+	return result;
+}
+
+bool MPBttnRtSchdlr::begin(const unsigned long int &baseTckMs, const UBaseType_t &taskPrty, const configSTACK_DEPTH_TYPE &stackDepth){
+	bool result {false};
+	BaseType_t taskCrtResult {pdFAIL};
+
+	if(_schdlrTaskHndl != NULL){
 		result = true;
-	_validVoidPend = result;
+	}
+	else if((baseTckMs > 0) && (_schdlrMtx != NULL)){
+		result = true;
+		for(MpbRtGrp_t &rtGrp : _rtGrpsLst){
+			if((rtGrp.rtMs % baseTckMs) == 0)
+				rtGrp.rtTcks = rtGrp.rtMs / baseTckMs;
+			else
+				result = false;
+		}
+		if(result){
+			_baseTckMs = baseTckMs;
+			_tcksCnt = 0;
+			for(MpbRtGrp_t &rtGrp : _rtGrpsLst){
+				//A staggered rate group is scanned every base tick, it's period ticks become the phases
+				rtGrp.rtGrp->_pollDelay = rtGrp.rtMs;
+				rtGrp.rtGrp->_setStggrdPhsQty((rtGrp.rtGrp->_stggrd)?rtGrp.rtTcks:1);
+				rtGrp.rtGrp->_rtSchdlrActv = true;
+			}
+			resetRtGrpsLd();
+			taskCrtResult = xTaskCreate(
+				schdlrTask,	//Task function
+				_schdlrName.c_str(),	//Task name
+				stackDepth,	//Stack depth in words
+				this,	//Parameter passed to the task function
+				taskPrty,	//Task priority
+				&_schdlrTaskHndl
+			);
+			if (taskCrtResult != pdPASS){
+				_schdlrTaskHndl = NULL;
+				for(MpbRtGrp_t &rtGrp : _rtGrpsLst)
+					rtGrp.rtGrp->_rtSchdlrActv = false;
+				result = false;
+			}
+		}
+	}
 
-	return _validVoidPend;
+	return result;
+}
+
+void MPBttnRtSchdlr::end(){
+	if (_schdlrTaskHndl){
+		//The mutex is taken to ensure the task is not deleted in the middle of a tick, holding a rate group's mutex
+		xSemaphoreTake(_schdlrMtx, portMAX_DELAY);
+		vTaskDelete(_schdlrTaskHndl);
+		_schdlrTaskHndl = NULL;
+		for(MpbRtGrp_t &rtGrp : _rtGrpsLst)
+			rtGrp.rtGrp->_rtSchdlrActv = false;
+		xSemaphoreGive(_schdlrMtx);
+	}
+
+	return;
+}
+
+MPBttnRtSchdlr::MpbRtGrp_t* MPBttnRtSchdlr::_getRtGrp(const unsigned long int &rtMs){
+	MpbRtGrp_t* result {nullptr};
+
+	for(MpbRtGrp_t &rtGrp : _rtGrpsLst){
+		if(rtGrp.rtMs == rtMs){
+			result = &rtGrp;
+			break;
+		}
+	}
+
+	return result;
+}
+
+MPBttnPollGrp* MPBttnRtSchdlr::getRtGrp(const unsigned long int &rtMs){
+	MpbRtGrp_t* rtGrpPtr {_getRtGrp(rtMs)};
+
+	return (rtGrpPtr != nullptr)?rtGrpPtr->rtGrp:nullptr;
+}
+
+MpbRtGrpLd_t MPBttnRtSchdlr::getRtGrpLd(const unsigned long int &rtMs){
+	MpbRtGrpLd_t result {0};
+	MpbRtGrp_t* rtGrpPtr {_getRtGrp(rtMs)};
+	unsigned long int cycsPerUs {SystemCoreClock / 1000000};
+
+	if(rtGrpPtr != nullptr){
+		taskENTER_CRITICAL();
+		result.rtMs = rtGrpPtr->rtMs;
+		result.scansCnt = rtGrpPtr->scansCnt;
+		result.scanMaxUs = rtGrpPtr->scanMaxCycs / cycsPerUs;
+		if(rtGrpPtr->scansCnt > 0)
+			result.scanMeanUs = static_cast<unsigned long int>((rtGrpPtr->scansCycs / rtGrpPtr->scansCnt) / cycsPerUs);
+		if(_ldElpsdCycs > 0)
+			result.ldPrmll = static_cast<unsigned long int>((rtGrpPtr->scansCycs * 1000) / _ldElpsdCycs);
+		taskEXIT_CRITICAL();
+	}
+
+	return result;
+}
+
+const std::size_t MPBttnRtSchdlr::getRtGrpsQty() const{
+
+	return _rtGrpsLst.size();
+}
+
+void MPBttnRtSchdlr::resetRtGrpsLd(){
+	//Enable the cycles counter used to measure the load, no harm done if it was already enabled
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	taskENTER_CRITICAL();
+	for(MpbRtGrp_t &rtGrp : _rtGrpsLst){
+		rtGrp.scansCnt = 0;
+		rtGrp.scanMaxCycs = 0;
+		rtGrp.scansCycs = 0;
+	}
+	_ldElpsdCycs = 0;
+	_ldRsync = true;
+	taskEXIT_CRITICAL();
+
+	return;
+}
+
+bool MPBttnRtSchdlr::rmvMPBttn(DbncdMPBttn* mpbObj){
+	bool result {false};
+
+	if(mpbObj != nullptr){
+		for(MpbRtGrp_t &rtGrp : _rtGrpsLst){
+			if(mpbObj->getMPBttnPollGrp() == rtGrp.rtGrp){
+				result = rtGrp.rtGrp->rmvMPBttn(mpbObj);
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+void MPBttnRtSchdlr::schdlrTask(void* schdlrTaskArg){
+	MPBttnRtSchdlr* schdlrObj = (MPBttnRtSchdlr*)schdlrTaskArg;
+	TickType_t lastWkTm {xTaskGetTickCount()};
+	uint32_t curCycCnt {0};
+	uint32_t scanCycs {0};
+
+	for(;;){
+		vTaskDelayUntil(&lastWkTm, pdMS_TO_TICKS(schdlrObj->_baseTckMs));
+		xSemaphoreTake(schdlrObj->_schdlrMtx, portMAX_DELAY);
+		curCycCnt = DWT->CYCCNT;
+		taskENTER_CRITICAL();
+		if(schdlrObj->_ldRsync)
+			schdlrObj->_ldRsync = false;
+		else
+			schdlrObj->_ldElpsdCycs += (curCycCnt - schdlrObj->_ldLastCycCnt);
+		schdlrObj->_ldLastCycCnt = curCycCnt;
+		taskEXIT_CRITICAL();
+
+		++(schdlrObj->_tcksCnt);
+		for(MpbRtGrp_t &rtGrp : schdlrObj->_rtGrpsLst){
+			if(rtGrp.rtGrp->_stggrd || ((schdlrObj->_tcksCnt % rtGrp.rtTcks) == 0)){
+				curCycCnt = DWT->CYCCNT;
+				rtGrp.rtGrp->scanMPBttns();
+				scanCycs = DWT->CYCCNT - curCycCnt;
+				taskENTER_CRITICAL();
+				if(scanCycs > rtGrp.scanMaxCycs)
+					rtGrp.scanMaxCycs = scanCycs;
+				rtGrp.scansCycs += scanCycs;
+				++rtGrp.scansCnt;
+				taskEXIT_CRITICAL();
+			}
+		}
+		xSemaphoreGive(schdlrObj->_schdlrMtx);
+	}
 }
 
 //=========================================================================> Class methods delimiter
@@ -3301,3 +5935,56 @@ MpbOtpts_t otptsSttsUnpkg(uint32_t pkgOtpts){
 
 	return mpbCurSttsDcdd;
 }
+
+/**
+ * @brief Returns the timer input capture digital filter setting (ICxF) for a requested filter length
+ *
+ * @param timClkHz The timer kernel clock frequency, in Hz.
+ * @param ckdDiv The timer clock division setting (1, 2 or 4) deriving the filter sampling clock (fDTS) from the timer clock.
+ * @param fltrTmNs The requested filter length, in nanoseconds.
+ * @return The ICxF setting of the shortest filter not shorter than the requested length, or the longest filter (0x0F) if no filter is long enough. 0 (no filter) for a 0 requested length.
+ */
+uint8_t icFltrFor(const uint32_t &timClkHz, const uint8_t &ckdDiv, const unsigned long int &fltrTmNs){
+	uint8_t result{0x0F};
+
+	if(fltrTmNs == 0){
+		result = 0;
+	}
+	else{
+		for(uint8_t icFltr{1}; icFltr <= 0x0F; ++icFltr){	//The filters lengths grow with the ICxF setting
+			if(icFltrTmNs(timClkHz, ckdDiv, icFltr) >= fltrTmNs){
+				result = icFltr;
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Returns the length of a timer input capture digital filter
+ *
+ * The filter validates a level after N consecutive equal samples, taken at the sampling frequency selected by the ICxF setting, being derived from the timer clock (fCK_INT) or from the filter clock (fDTS = fCK_INT / ckdDiv) as described in the STM32 reference manuals.
+ *
+ * @param timClkHz The timer kernel clock frequency, in Hz.
+ * @param ckdDiv The timer clock division setting (1, 2 or 4) deriving the filter sampling clock (fDTS) from the timer clock.
+ * @param icFltr The ICxF setting, 0x00 to 0x0F.
+ * @return The filter length, in nanoseconds. 0 for no filter, or invalid parameters.
+ */
+unsigned long int icFltrTmNs(const uint32_t &timClkHz, const uint8_t &ckdDiv, const uint8_t &icFltr){
+	//Sampling clock divider from fDTS (0 meaning fCK_INT) and N for each ICxF setting
+	static const uint8_t fltrSmplDiv[16]{0, 0, 0, 0, 2, 2, 4, 4, 8, 8, 16, 16, 16, 32, 32, 32};
+	static const uint8_t fltrSmplsN[16]{0, 2, 4, 8, 6, 8, 6, 8, 6, 8, 5, 6, 8, 5, 6, 8};
+	unsigned long int result{0};
+	uint64_t fltrClkCycs{0};
+
+	if((timClkHz > 0) && (icFltr > 0) && (icFltr <= 0x0F) && ((ckdDiv == 1) || (ckdDiv == 2) || (ckdDiv == 4))){
+		fltrClkCycs = fltrSmplsN[icFltr];
+		if(fltrSmplDiv[icFltr] > 0)
+			fltrClkCycs *= fltrSmplDiv[icFltr] * ckdDiv;
+		result = (fltrClkCycs * 1000000000ULL + timClkHz - 1) / timClkHz;	//Rounded up, the filter is never shorter than the value returned
+	}
+
+	return result;
+}
@@ -37,6 +37,7 @@
 
 #include <stdint.h>
 #include <string>
+#include <vector>
 #include <stdio.h>
 
 //===========================>> Next lines included for developing purposes, corresponding headers must be provided for the production platform/s
@@ -61,6 +62,8 @@
 
 #define _HwMinDbncTime 20  // Documented minimum wait time for a MPB signal to stabilize to consider it pressed or released (in milliseconds)
 #define _StdPollDelay 10	// Reasonable time between polls for MPBs switches (in milliseconds)
+#define _StdFastPollDelay 1	// Time between polls for adaptive polling MPBs while input activity or pending transitions are being processed (in milliseconds)
+#define _StdSlowPollDelay 50	// Time between polls for adaptive polling MPBs while the input and the state machine are stable (in milliseconds)
 #define _MinSrvcTime 100	// Minimum valid time value for service/active time for Time Latched MPBs to avoid stability issues relating to debouncing, releasing and other timed events
 #define _InvalidPinNum 0xFFFF	// Value to give as "yet to be defined", the "Valid pin number" range and characteristics are development platform and environment dependable
 
@@ -108,11 +111,117 @@ const uint8_t OtptCurValBitPos{16};
 	};
 #endif	//GPIOPINID_T
 
+#ifndef MPBPOLLPRDSTTS_T
+	#define MPBPOLLPRDSTTS_T
+	/**
+	 * @brief Type used to report the measured time between consecutive scans of a MPBttnPollGrp object, the scans period statistics.
+	 *
+	 * The measurements are made with the core cycles counter (DWT->CYCCNT) and converted to microseconds, so the dispersion of the values (the sampling jitter) is measured with a resolution far finer than the system tick.
+	 *
+	 * @struct MpbPollPrdStts_t
+	 */
+	struct MpbPollPrdStts_t{
+		unsigned long int prdsCnt;	/**< Number of periods measured*/
+		unsigned long int prdMinUs;	/**< Shortest period measured, in microseconds*/
+		unsigned long int prdMaxUs;	/**< Longest period measured, in microseconds*/
+		unsigned long int prdMeanUs;	/**< Mean of the periods measured, in microseconds*/
+	};
+#endif	//MPBPOLLPRDSTTS_T
+
+#ifndef MPBPOLLTCKLD_T
+	#define MPBPOLLTCKLD_T
+	/**
+	 * @brief Type used to report the number of MPB objects serviced in each scan of a MPBttnPollGrp object, the scans load statistics.
+	 *
+	 * For a Poll Group with staggered scans each scan services a single phase of the registered objects, so the values report the load the group adds to each tick, and the flatness of the load distribution.
+	 *
+	 * @struct MpbPollTckLd_t
+	 */
+	struct MpbPollTckLd_t{
+		unsigned long int scansCnt;	/**< Number of scans measured*/
+		unsigned long int srvcdMin;	/**< Lowest number of objects serviced by a scan*/
+		unsigned long int srvcdMax;	/**< Highest number of objects serviced by a scan*/
+		unsigned long int srvcdMean;	/**< Mean number of objects serviced by a scan, rounded down*/
+	};
+#endif	//MPBPOLLTCKLD_T
+
+#ifndef MPBPOLLLANELTNCY_T
+	#define MPBPOLLLANELTNCY_T
+	/**
+	 * @brief Type used to report the latency of a priority lane of a MPBttnPollGrp object.
+	 *
+	 * Two values are measured for each lane:
+	 * - The scan position: the time from the start of a scan to the end of the evaluation of the lane's objects. The lanes are evaluated in priority order, so the scan position of a lane only depends on the objects of the same or higher priority lanes.
+	 * - The press latency: the time from the moment a lane's object press is due to be validated (the press first detection time plus the debounce time and the start delay) to the end of the service where the object's outputs change as a result of that press, and the task to notify, if any, is notified.
+	 *
+	 * @struct MpbPollLaneLtncy_t
+	 */
+	struct MpbPollLaneLtncy_t{
+		uint8_t lanePrty;	/**< The lane priority*/
+		std::size_t mpbsQty;	/**< Number of MPB objects registered in the lane*/
+		unsigned long int scansCnt;	/**< Number of scans measured*/
+		unsigned long int scanPosMaxUs;	/**< Worst case scan position measured, in microseconds*/
+		unsigned long int scanPosMeanUs;	/**< Mean scan position measured, in microseconds*/
+		unsigned long int prssCnt;	/**< Number of presses measured*/
+		unsigned long int prssLtncyMaxUs;	/**< Worst case press latency measured, in microseconds*/
+		unsigned long int prssLtncyMeanUs;	/**< Mean press latency measured, in microseconds*/
+	};
+#endif	//MPBPOLLLANELTNCY_T
+
+#ifndef MPBRTGRPLD_T
+	#define MPBRTGRPLD_T
+	/**
+	 * @brief Type used to report the CPU load of a rate group of a MPBttnRtSchdlr object.
+	 *
+	 * @struct MpbRtGrpLd_t
+	 */
+	struct MpbRtGrpLd_t{
+		unsigned long int rtMs;	/**< The rate group period, in milliseconds*/
+		unsigned long int scansCnt;	/**< Number of scans of the rate group measured*/
+		unsigned long int scanMaxUs;	/**< Longest scan time, in microseconds*/
+		unsigned long int scanMeanUs;	/**< Mean scan time, in microseconds*/
+		unsigned long int ldPrmll;	/**< CPU time used by the rate group scans, in per mille of the time elapsed*/
+	};
+#endif	//MPBRTGRPLD_T
+
+#ifndef MPBBNCTRN_T
+	#define MPBBNCTRN_T
+	/**
+	 * @brief Type used to report the bounce train measured for a press or a release of a MPB object.
+	 *
+	 * The bounce train starts with the first detection of the new level, and ends when the level is kept stable long enough to be validated.
+	 *
+	 * @struct MpbBncTrn_t
+	 */
+	struct MpbBncTrn_t{
+		unsigned long int bncTm;	/**< Time from the first detection of the level to the start of the stable period that validated it, in milliseconds*/
+		uint16_t trnstnsQty;	/**< Number of input level transitions detected in the bounce train, including the first one*/
+	};
+#endif	//MPBBNCTRN_T
+
+#ifndef MPBCHTTRSTTS_T
+	#define MPBCHTTRSTTS_T
+	/**
+	 * @brief Type used to report the chatter statistics of a MPB object, see DbncdMPBttn::getChttrStts().
+	 *
+	 * @struct MpbChttrStts_t
+	 */
+	struct MpbChttrStts_t{
+		unsigned long int bncTrnsCnt;	/**< Number of bounce trains measured, one for each valid press and one for each valid release*/
+		unsigned long int chttrTrnsCnt;	/**< Number of bounce trains measured with more than one transition*/
+		unsigned long int trnstnsCnt;	/**< Number of input level transitions detected in all the bounce trains measured*/
+		unsigned long int bncTmAvgUs;	/**< Rolling average of the bounce times measured, in microseconds*/
+		unsigned long int bncTmMaxMs;	/**< Longest bounce time measured, in milliseconds*/
+	};
+#endif	//MPBCHTTRSTTS_T
+
 // Definition workaround to let a function/method return value to be a function pointer
 typedef void (*fncPtrType)();
 typedef  fncPtrType (*ptrToTrnFnc)();
 
 //===========================>> BEGIN General use function prototypes
+uint8_t icFltrFor(const uint32_t &timClkHz, const uint8_t &ckdDiv, const unsigned long int &fltrTmNs);
+unsigned long int icFltrTmNs(const uint32_t &timClkHz, const uint8_t &ckdDiv, const uint8_t &icFltr);
 uint8_t singleBitPosNum(uint16_t mask);
 MpbOtpts_t otptsSttsUnpkg(uint32_t pkgOtpts);
 //===========================>> END General use function prototypes
@@ -121,6 +230,30 @@ MpbOtpts_t otptsSttsUnpkg(uint32_t pkgOtpts);
 //===========================>> END General use Global variables
 
 //==========================================================>> Classes declarations BEGIN
+class DbncdMPBttn;
+class MPBttnInptSrc;
+class MPBttnPollGrp;
+
+#ifndef MPBTMRWHLND_T
+	#define MPBTMRWHLND_T
+	/**
+	 * @brief Type of the intrusive node used to keep a MPB object's next deadline in a MPBttnTmrWhl object.
+	 *
+	 * Each MPB object holds it's own node, so scheduling and cancelling a deadline never allocates memory, and both operations are O(1) as the node is linked to and unlinked from a doubly linked list.
+	 *
+	 * @struct MpbTmrWhlNd_t
+	 */
+	struct MpbTmrWhlNd_t{
+		MpbTmrWhlNd_t* prev;	/**< Previous node in the wheel slot list, nullptr for the slot's first node*/
+		MpbTmrWhlNd_t* next;	/**< Next node in the wheel slot list, or in the expired nodes list returned by MPBttnTmrWhl::advance(const unsigned long int)*/
+		unsigned long int expTm;	/**< Deadline timestamp, in milliseconds*/
+		DbncdMPBttn* mpbObj;	/**< The MPB object owning the node*/
+		uint8_t whlLvl;	/**< Wheel level the node is linked to*/
+		uint8_t whlSlot;	/**< Slot of the wheel level the node is linked to*/
+		bool lnkd;	/**< The node is linked to a wheel slot*/
+	};
+#endif	//MPBTMRWHLND_T
+
 /**
  * @brief Base class, models a Debounced Momentary Push Button (**D-MPB**).
  *
@@ -139,6 +272,15 @@ protected:
 		stOnVRP,
 		stDisabled
 	};
+	struct BncTrnStt_t{
+		unsigned long int strtTm;	//First detection of the level, 0 while no bounce train is in progress
+		unsigned long int intrTm;	//Last interruption of the level detection, 0 while the level is detected
+		uint16_t trnstnsQty;
+		MpbBncTrn_t lastTrn;
+	};
+	static const uint8_t _cptrMpbLstLen {16};
+	static const uint8_t _dbncLrnSmplsQty {16};
+	static const uint8_t _dbncLrnMinSmpls {8};
 	const unsigned long int _stdMinDbncTime {_HwMinDbncTime};
 
 	GPIO_TypeDef* _mpbttnPort{};
@@ -149,39 +291,114 @@ protected:
 
 	unsigned long int _dbncRlsTimerStrt{0};
 	unsigned long int _dbncRlsTimeTempSett{0};
+	bool _adptvPoll{false};
+	unsigned long int _bncTmAvg{0};	//Rolling average of the bounce times, in 1/256 milliseconds
+	uint8_t _bncTmAvgShft{3};
+	unsigned long int _bncTmMax{0};
+	BncTrnStt_t _bncTrns[2]{};	//Index 0 for the press bounce trains, 1 for the release bounce trains
+	unsigned long int _bncTrnsCnt{0};
+	unsigned long int _bncTrnstnsCnt{0};
+	HAL_TIM_ActiveChannel _cptrActvChnl{HAL_TIM_ACTIVE_CHANNEL_CLEARED};
+	static DbncdMPBttn* _cptrMpbLst[_cptrMpbLstLen];
+	uint32_t _cptrTimChnl{0};
+	TIM_HandleTypeDef* _cptrTimHndl{NULL};
+	bool _cptrUsTmStmp{false};
+	unsigned long int _chttrTrnsCnt{0};
+	bool _cntctDgrdd{false};
+	unsigned long int _cntctDgrdThrshld{0};
+	unsigned long int _curPollDelay{0};
+	bool _dbncLrn{false};
+	unsigned long int _dbncLrnMax{0};
+	unsigned long int _dbncLrnMin{0};
+	unsigned long int _dbncLrnMrgn{0};
+	uint8_t _dbncLrnPrcntl{0};
+	uint16_t _dbncLrnSmpls[_dbncLrnSmplsQty]{};
+	uint8_t _dbncLrnSmplsCnt{0};
+	uint8_t _dbncLrnSmplsIdx{0};
 	unsigned long int _dbncTimerStrt{0};
 	unsigned long int _dbncTimeTempSett{0};
+	bool _edgeTrgrd{false};
+	volatile bool _extiEdgePend{false};
+	static DbncdMPBttn* _extiMpbLst[16];
+	volatile bool _extiPollActv{false};
+	bool _extiTrgrd{false};
+	unsigned long int _fastPollDelay{_StdFastPollDelay};
+	void (*_fnWhnCntctDgrdd)() {nullptr};
 	void (*_fnWhnTrnOff)() {nullptr};
 	void (*_fnWhnTrnOn)() {nullptr};
+	unsigned long int _hwFltrTmNs{0};
+	MPBttnInptSrc* _inptSrc{nullptr};
+	uint16_t _inptSrcId{0};
    bool _isEnabled{true};
 	volatile bool _isOn{false};
    bool _isOnDisabled{false};
 	volatile bool _isPressed{false};
+	uint32_t _lastPrssTmStmp{0};
+	uint32_t _lastRlsTmStmp{0};
+	unsigned long int _minOnTm{0};
 	fdaDmpbStts _mpbFdaState {stOffNotVPP};
+	MPBttnPollGrp* _mpbPollGrp {nullptr};
 	TimerHandle_t _mpbPollTmrHndl {NULL};
 	std::string _mpbPollTmrName {""};
+	unsigned long int _onTmStrt{0};
 	volatile bool _outputsChange {false};
+	bool _plcyDbncd{false};
+	unsigned long int _pollDelay{0};
+	uint8_t _pollLanePrty{0};
+	std::size_t _pollPhs{0};
+	volatile bool _pollPsd{false};
+	const uint32_t* _portSnpsht{nullptr};
+	uint16_t _prssdLvlInvMsk{0};
+	unsigned long int _prssLtncyDdln{0};
+	bool _prssLtncyPend{false};
+	unsigned long int _pollsCnt{0};
+	unsigned long int _pollsCntStrt{0};
 	bool _prssRlsCcl{false};
+	unsigned long int _slowPollDelay{_StdSlowPollDelay};
    unsigned long int _strtDelay {0};
 	bool _sttChng {true};
 	TaskHandle_t _taskToNotifyHndl {NULL};
 	TaskHandle_t _taskWhileOnHndl{NULL};
+	volatile bool _tmrWhlDrmnt{false};
+	MpbTmrWhlNd_t _tmrWhlNd{nullptr, nullptr, 0, this, 0, 0, false};
 	volatile bool _validDisablePend{false};
 	volatile bool _validEnablePend{false};
 	volatile bool _validPressPend{false};
 	volatile bool _validReleasePend{false};
+	bool _xtrnDbncd{false};
+	volatile bool _xtrnPinLvl{false};
+	volatile bool _xtrnPinLvlChng{false};
+	volatile unsigned long int _xtrnPinLvlTm{0};
+	volatile uint32_t _xtrnPinLvlTmUs{0};
+	bool _xtrnSmplng{false};
 
+	void _bncTrnDtct(const uint8_t &trnIdx, const unsigned long int &dtctTm, const unsigned long int &maxGap);
+	void _bncTrnIntr(const uint8_t &trnIdx, const unsigned long int &intrTm);
+	void _bncTrnVldt(const uint8_t &trnIdx, const unsigned long int &stblStrtTm);
+	void _chttrSttsUpd(const MpbBncTrn_t &bncTrn);
 	void clrSttChng();
+	void _dbncLrnUpd(const unsigned long int &bncTm);
+	static void _edgeWkpFromISR(DbncdMPBttn* mpbObj, BaseType_t* pxHigherPriorityTaskWoken);
+	uint32_t _edgeTmStmp(const unsigned long int &edgeTm);
 	const bool getIsPressed() const;
+	virtual bool _isStbl();
+	virtual bool _isTmdSttPend();
 	static void mpbPollCallback(TimerHandle_t mpbTmrCb);
+	virtual void mpbPollUpd();
 	virtual uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	void _pollWkp();
+	virtual bool _rdIsPressed();
    void _setIsEnabled(const bool &newEnabledValue);
+	void _setPrssdLvlInvMsk();
    void setSttChng();
 	void _turnOff();
 	void _turnOn();
 	virtual void updFdaState();
-	bool updIsPressed();
+	virtual bool updIsPressed();
 	virtual bool updValidPressesStatus();
+
+	friend class MPBttnDmaSmplr;
+	friend class MPBttnPollGrp;
 public:
 	/**
 	 * @brief Default class constructor
@@ -222,7 +439,9 @@ public:
 	 *
 	 * @return Boolean indicating if the object could be attached to a timer.
 	 * @retval true: the object could be attached to a timer -or it was already attached to a timer when the method was invoked-.
-	 * @retval false: the object could not create the needed timer, or the object could not be attached to it.
+	 * @retval false: the object could not create the needed timer, or the object could not be attached to it, or the object is already serviced by a MPBttnPollGrp object.
+	 *
+	 * @note Objects registered in a MPBttnPollGrp object are updated by the group's single timer, so they must not be attached to a timer of their own. See MPBttnPollGrp::addMPBttn(DbncdMPBttn*, const uint8_t&).
 	 */
 	virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
 	/**
@@ -266,6 +485,12 @@ public:
 	 * @retval false: the object detachment and/or entry removal was rejected by the O.S..
 	 */
 	bool end();
+	/**
+	 * @brief Returns the value of the adptvPoll attribute
+	 *
+	 * @return The current value of the adptvPoll attribute, see setAdptvPoll(const bool, const unsigned long int, const unsigned long int).
+	 */
+	const bool getAdptvPoll() const;
 	/**
 	 * @brief Returns the current debounce time set for the object.
 	 *
@@ -274,6 +499,40 @@ public:
 	 * @return The current debounce time in milliseconds
 	 */
    const unsigned long int getCurDbncTime() const;
+	/**
+	 * @brief Returns the time between polls currently used by the object's timer.
+	 *
+	 * For objects not in adaptive polling mode the value is the one set by the begin(const unsigned long int) method, for objects in adaptive polling mode it's the fast or the slow poll delay depending on the object's activity.
+	 *
+	 * @return The current time between polls in milliseconds, 0 if the object's timer was not started.
+	 */
+	const unsigned long int getCurPollDelay() const;
+	/**
+	 * @brief Returns the value of the dbncLrn attribute
+	 *
+	 * The dbncLrn attribute indicates if the debounce time is being adjusted to the measured bounce trains of the MPB. See setDbncLrn(const bool&, const uint8_t&, const unsigned long int&, const unsigned long int&, const unsigned long int&) for details.
+	 *
+	 * @return The current value of the dbncLrn attribute.
+	 */
+	const bool getDbncLrn() const;
+	/**
+	 * @brief Returns the chatter statistics of the MPB
+	 *
+	 * The statistics are built from the bounce trains measured for every valid press and release (see getLastPrssBncTrn()): the number of bounce trains measured, the number of those that chattered (more than one transition detected), the total number of transitions, the longest bounce time and a rolling average of the bounce times. Worn contacts show longer bounce trains long before they fail, so the statistics can be used to predict the MPB maintenance needs, see setCntctDgrdThrshld(const unsigned long int&, const uint8_t&).
+	 *
+	 * @return A MpbChttrStts_t structure with the statistics since the instantiation or the last resetChttrStts() execution.
+	 */
+	const MpbChttrStts_t getChttrStts() const;
+	/**
+	 * @brief Returns the value of the cntctDgrdd attribute flag
+	 *
+	 * The flag is set when the rolling average of the bounce times exceeds the threshold set by setCntctDgrdThrshld(const unsigned long int&, const uint8_t&), and it's kept set until resetChttrStts() is executed.
+	 *
+	 * @return The current value of the cntctDgrdd attribute flag.
+	 * @retval true: the MPB contact is degrading.
+	 * @retval false: no contact degradation was detected.
+	 */
+	const bool getCntctDgrdd() const;
 	/**
 	 * @brief Returns the function that is set to execute every time the object **enters** the **Off State**.
 	 *
@@ -296,6 +555,21 @@ public:
 	 * 	 * @warning The function code execution will become part of the list of procedures the object executes when it entering the **On State**, including the modification of affected attribute flags, suspending the execution of the task running while in **On State** and others. Making the function code too time demanding must be handled with care, using alternative execution schemes, for example the function might resume a independent task that suspends itself at the end of its code, to let a new function calling event resume it once again.
 	 */
    fncPtrType getFnWhnTrnOn();
+	/**
+	 * @brief Returns the function that is set to execute when the contact degradation is detected.
+	 *
+	 * The function to be executed is an attribute that might be modified by the **setFnWhnCntctDgrddPtr()** method.
+	 *
+	 * @return A function pointer to the function set to execute when the cntctDgrdd flag is set.
+	 * @retval nullptr if there is no function set to execute when the contact degradation is detected.
+	 */
+	fncPtrType getFnWhnCntctDgrdd();
+	/**
+	 * @brief Returns the length of the hardware input filter set for the object's pin
+	 *
+	 * @return The filter length in nanoseconds, see setHwFltr(TIM_HandleTypeDef*, const uint32_t&, const uint32_t&, const unsigned long int&, const bool&). 0 if no hardware filter is set.
+	 */
+	const unsigned long int getHwFltrTmNs() const;
    /**
 	 * @brief Returns the value of the isEnabled attribute flag, indicating the **Enabled** or **Disabled** status of the object.
 	 *
@@ -326,6 +600,96 @@ public:
     * @retval false: the object is configured to be set to the **Off state** while it is in **Disabled state**.
     */
    const bool getIsOnDisabled() const;
+	/**
+	 * @brief Returns the bounce train measured for the last valid press of the MPB
+	 *
+	 * The bounce train is measured by the debouncing process: it starts with the first detection of the pressed level, every interruption of the detection shorter than the debounce time adds two transitions to it, and it ends when the pressed level is validated. A detection interrupted for longer than the debounce time was a glitch, and the bounce train is started again from the next detection.
+	 *
+	 * @return A MpbBncTrn_t structure with the bounce train measured, all fields are 0 if no valid press was detected yet.
+	 *
+	 * @note The bounce time resolution is the polling delay, a bounce train shorter than the polling delay might be measured with a 0 ms bounce time and a single transition. Objects with an input debounced by other mechanisms (vertical counters, hardware filters, debounce policies) measure the input as delivered by those mechanisms.
+	 */
+	const MpbBncTrn_t getLastPrssBncTrn() const;
+	/**
+	 * @brief Returns the timestamp of the last valid press of the MPB
+	 *
+	 * The timestamp is the time of the input edge starting the stable input level validated as a press (the last bounce edge for a bouncing input), in microseconds. For an object with a hardware input filter set (see setHwFltr(TIM_HandleTypeDef*, const uint32_t&, const uint32_t&, const unsigned long int&, const bool&)) on a free running 32 bits timer (i.e. TIM2 or TIM5, auto-reload value 0xFFFFFFFF) counting at 1 MHz, the edge time is the timer counter value captured by the hardware on the filtered edge, so it has microsecond accuracy in the capture timer time base. For the other objects, including the ones with a hardware input filter set on a timer not matching those conditions, the edge time is the system tick time when the edge was detected, converted to microseconds, with millisecond resolution and the polling delay added.
+	 *
+	 * @return The timestamp in microseconds, 0 if no valid press was detected yet.
+	 *
+	 * @note The timestamps are monotonic, and wrap around at the 32 bits unsigned range, about 71.6 minutes. The captured timestamps are the timer counter values, so they can be correlated with any other event timed with the same timer. A 16 bits timer, or a timer counting at other rates, wraps around in a fraction of that range (65.5 milliseconds for a 16 bits timer counting at 1 MHz), so it's captured values are not used as timestamps.
+	 */
+	const uint32_t getLastPrssTmStmp() const;
+	/**
+	 * @brief Returns the timestamp of the last valid release of the MPB
+	 *
+	 * See getLastPrssTmStmp() for the timestamps source and accuracy.
+	 *
+	 * @return The timestamp in microseconds, 0 if no valid release was detected yet.
+	 */
+	const uint32_t getLastRlsTmStmp() const;
+	/**
+	 * @brief Returns the bounce train measured for the last valid release of the MPB
+	 *
+	 * See getLastPrssBncTrn() for the bounce train measurement.
+	 *
+	 * @return A MpbBncTrn_t structure with the bounce train measured, all fields are 0 if no valid release was detected yet.
+	 */
+	const MpbBncTrn_t getLastRlsBncTrn() const;
+	/**
+	 * @brief Returns the value of the extiTrgrd attribute
+	 *
+	 * The extiTrgrd attribute indicates if the object is polled continuously or only when the MPB input activity requires it. See setExtiTrgrd(const bool) for details.
+	 *
+	 * @return The current value of the extiTrgrd attribute.
+	 * @retval true: the object is in EXTI triggered mode, the input is polled only while activity is detected.
+	 * @retval false: the object input is polled periodically while the object's timer is running.
+	 */
+	const bool getExtiTrgrd() const;
+	/**
+	 * @brief Returns the poll group servicing the object, if any.
+	 *
+	 * @return A pointer to the MPBttnPollGrp object the MPB is registered in.
+	 * @retval nullptr: the object is not registered in any poll group, it's updated by it's own timer (see begin(const unsigned long int)).
+	 */
+	MPBttnPollGrp* getMPBttnPollGrp() const;
+	/**
+	 * @brief Returns the minimum On time set for the object
+	 *
+	 * See setMinOnTm(const unsigned long int&) for details.
+	 *
+	 * @return The minimum On time in milliseconds, 0 if the On time is not stretched.
+	 */
+	const unsigned long int getMinOnTm() const;
+	/**
+	 * @brief Returns the time of the object's next deadline
+	 *
+	 * A deadline is the moment a time driven process of the object will be due, without any change in the MPB input being needed: the end of a debounce process (press or release), the end of the service time, the start of the warning period, the end of the voiding time, the activation of the second mode of a double action MPB, etc. Each class computes the deadlines of the time driven processes it implements, and returns the earliest one.
+	 *
+	 * The value is used by the EXTI triggered mode (see setExtiTrgrd(const bool)) to stop polling while waiting for a timed state to expire, scheduling the next timer expiration for the deadline, and by the adaptive polling mode (see setAdptvPoll(const bool, const unsigned long int, const unsigned long int)) to avoid the slow poll delay overshooting a deadline. Keeping the system timers expirations scheduled only for the deadlines lets the MCU sleep through long timed states when the FreeRTOS tickless idle mode (configUSE_TICKLESS_IDLE) is used.
+	 *
+	 * @return The time stamp of the next deadline, in milliseconds, in the same time base used by the object to time it's processes (xTaskGetTickCount() / portTICK_RATE_MS).
+	 * @retval 0: there is no deadline pending.
+	 */
+	virtual const unsigned long int getNxtDdln() const;
+	/**
+	 * @brief Returns the number of polls avoided by the object since the counters were started
+	 *
+	 * The value is the difference between the number of polls a timer running at the period set by begin(const unsigned long int) would have executed since the counters were started, and the number of polls actually executed (see getPollsCnt()). The avoided polls are the result of the adaptive polling mode and the EXTI triggered mode.
+	 *
+	 * @return The number of avoided polls, a negative value indicates more polls were executed than the ones the plain periodic polling would have executed.
+	 *
+	 * @note The counters are started by the begin(const unsigned long int) method and restarted by the resetPollsCnt() method. As the counters use milliseconds based time stamps they should be restarted at least every 49 days.
+	 */
+	const long int getPollsAvdd() const;
+	/**
+	 * @brief Returns the number of polls executed by the object since the counters were started
+	 *
+	 * @return The number of executed polls.
+	 *
+	 * @note See getPollsAvdd() for the counters start and restart.
+	 */
+	const unsigned long int getPollsCnt() const;
    /**
 	 * @brief Returns the relevant attribute flags values for the object state encoded as a 32 bits value, required to pass current state of the object to another thread/task managing the outputs
     *
@@ -389,6 +753,32 @@ public:
 	 * All the parameters correspond to the non-default constructor of the class, DbncdMPBttn(gpioPinId_t, const bool, const bool, const unsigned long int)
 	 */
 	bool init(gpioPinId_t mpbttnPinStrct, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0);
+	/**
+	 * @brief Timers input capture entry point for the objects with a hardware input filter
+	 *
+	 * When a filtered edge is captured in the timer channel of a MPB object set by setHwFltr(TIM_HandleTypeDef*, const uint32_t&, const uint32_t&, const unsigned long int&, const bool&) this method records the new input level for the object, and restarts the object's polling timer, as mpbExtiCallback(uint16_t) does for the EXTI triggered objects.
+	 *
+	 * The method must be invoked from the application's HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef*) function, passing along the received htim parameter. Captures of channels not registered by a MPB object are ignored.
+	 *
+	 * @param htim Pointer to the HAL handle of the timer that captured the edge.
+	 *
+	 * @note As the channel captures both edges of the filtered input each capture toggles the recorded input level, which is synchronized with the pin level when the filter is set. The raw pin is not read, it might be bouncing when the interrupt is serviced.
+	 * @note The method uses the FreeRTOS "FromISR" API, so the timer interrupt priority must be numerically equal to or greater than configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY.
+	 */
+	static void mpbCptrCallback(TIM_HandleTypeDef* htim);
+	/**
+	 * @brief EXTI lines edge detection entry point for the objects in EXTI triggered mode
+	 *
+	 * When an edge is detected in the EXTI line of a MPB object set to EXTI triggered mode (see setExtiTrgrd(const bool)) this method restarts the object's polling timer, that will keep running until the input is stable and no timed state is pending.
+	 *
+	 * The method must be invoked from the application's HAL_GPIO_EXTI_Callback(uint16_t) function, passing along the received GPIO_Pin parameter. Edges on lines not registered by a MPB object are ignored, so the method might be invoked for every EXTI line activated.
+	 *
+	 * @param GPIO_Pin The GPIO pin mask of the EXTI line that detected the edge, as received by the HAL_GPIO_EXTI_Callback(uint16_t) function.
+	 *
+	 * @note The method uses the FreeRTOS "FromISR" API, so the EXTI lines interrupts priority must be numerically equal to or greater than configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, as set by setExtiTrgrd(const bool).
+	 * @note Invoking this method directly with a pin mask simulates an edge in the corresponding EXTI line.
+	 */
+	static void mpbExtiCallback(uint16_t GPIO_Pin);
 	/**
 	 * @brief Pauses the software timer updating the computation of the object's internal flags value.
 	 *
@@ -404,12 +794,24 @@ public:
 	 *  The debounce process time used at instantiation might be changed with the setDbncTime() as needed, as many times as needed. This method reverts the value to the instantiation time value. In case the value was not specified at instantiation time the default debounce time value will be used.
 	 */
 	void resetDbncTime();
+	/**
+	 * @brief Resets the chatter statistics of the MPB
+	 *
+	 * The counters, the longest bounce time and the bounce times rolling average are set to 0, and the cntctDgrdd flag is reset, i.e. after a contact replacement. See getChttrStts().
+	 */
+	void resetChttrStts();
 	/**
 	 * @brief Resets the MPB behavior automaton to it's **Initial** or **Start State**
 	 *
 	 * This method is provided for security and for error handling purposes, so that in case of unexpected situations detected, the driving **Deterministic Finite Automaton** used to compute the MPB objects states might be reset to it's initial state to safely restart it, usually as part of an **Error Handling** procedure.
 	 */
 	void resetFda();
+	/**
+	 * @brief Restarts the polls counters.
+	 *
+	 * See getPollsCnt() and getPollsAvdd().
+	 */
+	void resetPollsCnt();
 	/**
 	 * @brief Restarts the software timer updating the calculation of the object internal flags.
 	 *
@@ -421,6 +823,57 @@ public:
 	 * @warning This method will restart the inactive timer after a **pause()** method. If the object's timer was modified by an **end()* method then a **begin()** method will be needed to restart it's timer.
 	 */
 	bool resume();
+	/**
+	 * @brief Sets the adaptive polling mode of the object
+	 *
+	 * In the adaptive polling mode the object's timer period is changed according to the object's activity: while a press or release debounce process is in progress, a state machine transition is pending or a second mode (slider) is active the fast poll delay is used, keeping the press latency low. When the input and the state machine are stable the slow poll delay is used, reducing the timer expirations while the MPB is idle or in a steady latched state.
+	 *
+	 * @param newAdptvPoll The new value for the adptvPoll attribute.
+	 * @param fastPollDelay (Optional) Time between polls while the object is active, in milliseconds.
+	 * @param slowPollDelay (Optional) Time between polls while the object is stable, in milliseconds.
+	 *
+	 * @return Boolean indicating if the setting was successful.
+	 * @retval true: the mode and the poll delays were set. When the mode is disabled the timer period is set back to the value set by begin(const unsigned long int).
+	 * @retval false: the fastPollDelay is shorter than a system tick, or the slowPollDelay is shorter than the fastPollDelay. No change was made.
+	 *
+	 * @note Timed states (service time, voiding time, etc.) are resolved with the granularity of the slow poll delay. The first detection of a press is done at the slow poll rate, so it adds up to the slowPollDelay to the press latency, unless the object is also in EXTI triggered mode (see setExtiTrgrd(const bool)), where the edge restarts the polling at the fast rate.
+	 * @note The adaptive polling mode applies to objects running their own timer, objects serviced by a MPBttnPollGrp are polled at the group's rate.
+	 */
+	bool setAdptvPoll(const bool &newAdptvPoll, const unsigned long int &fastPollDelay = _StdFastPollDelay, const unsigned long int &slowPollDelay = _StdSlowPollDelay);
+	/**
+	 * @brief Sets the contact degradation detection threshold
+	 *
+	 * Every bounce train measured updates the rolling average of the bounce times, an exponential moving average where the last bounce time measured has a weight of 1/2^avgShft. When the average exceeds the threshold the cntctDgrdd flag is set and the function set by setFnWhnCntctDgrddPtr(void(*)()) is executed, once, until the statistics are reset by resetChttrStts().
+	 *
+	 * @param newBncTmThrshld Bounce times rolling average threshold, in milliseconds. A 0 value disables the detection.
+	 * @param avgShft (Optional) Weight of the last bounce time in the rolling average, as a power of 2 divisor, from 1 (1/2) to 8 (1/256). Bigger values make the average less sensitive to a single long bounce train.
+	 *
+	 * @return Boolean indicating if the setting was successful.
+	 * @retval true: the parameters were set.
+	 * @retval false: the avgShft is out of range. No change was made.
+	 *
+	 * @note The bounce times are measured with the polling delay resolution, the threshold must be set well over the polling delay.
+	 */
+	bool setCntctDgrdThrshld(const unsigned long int &newBncTmThrshld, const uint8_t &avgShft = 3);
+	/**
+	 * @brief Sets the debounce time learning mode of the object
+	 *
+	 * In the learning mode the bounce time of every valid press and release is measured (see getLastPrssBncTrn()) and kept in a buffer of the last 16 measurements. Once at least 8 measurements are buffered, every new measurement sets the debounce time to the requested percentile of the buffered bounce times plus a safety margin, limited to the [dbncMin, dbncMax] range, so the debounce time follows the actual contact behavior instead of a worst case guess.
+	 *
+	 * @param newDbncLrn The new value for the dbncLrn attribute.
+	 * @param prcntl (Optional) Percentile of the buffered bounce times used as base for the debounce time, from 0 (the shortest bounce time) to 100 (the longest bounce time).
+	 * @param mrgn (Optional) Safety margin added to the percentile bounce time, in milliseconds. As the bounce times are measured with the polling delay resolution, the margin applied is never less than the object's polling delay (the fast poll delay in adaptive polling mode, the Poll Group's polling delay for an object serviced by a MPBttnPollGrp), whatever the value set.
+	 * @param dbncMin (Optional) Minimum debounce time to be set by the learning mode, in milliseconds. Defaults to the _HwMinDbncTime empirical minimum.
+	 * @param dbncMax (Optional) Maximum debounce time to be set by the learning mode, in milliseconds.
+	 *
+	 * @return Boolean indicating if the setting was successful.
+	 * @retval true: the mode and its parameters were set. Enabling the mode clears the buffered measurements, disabling it keeps the last debounce time set, resetDbncTime() restores the original value.
+	 * @retval false: the prcntl is over 100, the dbncMin is 0 or the dbncMax is less than the dbncMin. No change was made.
+	 *
+	 * @note The dbncMin might be set under the _HwMinDbncTime empirical minimum enforced by setDbncTime(const unsigned long int), as the learned value is based on the bounce times measured for the actual contact, not on a generic estimation. Doing so is only meaningful with polling delays short enough to resolve the contact bounces: at the standard 10 milliseconds polling delay most bounce trains are measured as a single transition with a 0 milliseconds bounce time.
+	 * @note Only the press debounce time is adjusted, the release debounce time is kept unchanged.
+	 */
+	bool setDbncLrn(const bool &newDbncLrn, const uint8_t &prcntl = 95, const unsigned long int &mrgn = _StdPollDelay, const unsigned long int &dbncMin = _HwMinDbncTime, const unsigned long int &dbncMax = 100);
 	/**
 	 * @brief Sets the debounce time.
 	 *
@@ -433,6 +886,31 @@ public:
 	 * @retval false: the value was out of the accepted range, no change was made.
 	 */
 	bool setDbncTime(const unsigned long int &newDbncTime);
+	/**
+	 * @brief Sets the EXTI triggered mode of the object
+	 *
+	 * In the EXTI triggered mode the MPB pin is configured to generate an EXTI interrupt on both edges, and the object's timer is kept stopped while nothing is happening: an edge restarts the polling, that keeps running while a debounce process is in progress, the state machine has pending transitions, or a timed state (service time, voiding time, second mode activation, etc.) is in progress. When the input is stable and nothing is pending the timer is stopped again, so the idle object takes no CPU time. While the only pending matter is a timed state with a known deadline (see getNxtDdln()) the timer is not kept polling, it's scheduled to expire at the deadline.
+	 *
+	 * @param newExtiTrgrd The new value for the extiTrgrd attribute.
+	 *
+	 * @return Boolean indicating if the setting was successful.
+	 * @retval true: the mode was set, or the object was already in the requested mode.
+	 * @retval false: the object has no valid pin, the object is serviced by a MPBttnPollGrp, the object's input is provided by an input source (see setInptSrc(MPBttnInptSrc*, const uint16_t&)), the object has a hardware input filter set (see setHwFltr(TIM_HandleTypeDef*, const uint32_t&, const uint32_t&, const unsigned long int&, const bool&)), or the EXTI line corresponding to the pin number is already used by another MPB object.
+	 *
+	 * @note Each EXTI line is shared by the pins with the same number of all the GPIO ports, so only one MPB object for each pin number might use the EXTI triggered mode.
+	 * @note The application must route the EXTI interrupts to the HAL (EXTIx_IRQHandler() invoking HAL_GPIO_EXTI_IRQHandler()) and the HAL_GPIO_EXTI_Callback(uint16_t) must invoke mpbExtiCallback(uint16_t).
+	 */
+	bool setExtiTrgrd(const bool &newExtiTrgrd);
+	/**
+	 * @brief Sets the function that will be called to execute when the contact degradation is detected.
+	 *
+	 * The function to be executed must be of the form **void (*newFnWhnCntctDgrdd)()**, meaning it must take no arguments and must return no value, it will be executed once each time the cntctDgrdd flag is set (see setCntctDgrdThrshld(const unsigned long int&, const uint8_t&)). When instantiated the attribute value is set to **nullptr**.
+	 *
+	 * @param newFnWhnCntctDgrdd Function pointer to the function intended to be called when the contact degradation is detected. Passing **nullptr** as parameter deactivates the function execution mechanism.
+	 *
+	 * @note The function is executed by the object's polling mechanism, it must be short and must not block, as the other functions set to execute on the object events.
+	 */
+	void setFnWhnCntctDgrddPtr(void(*newFnWhnCntctDgrdd)());
 	/**
 	 * @brief Sets the function that will be called to execute every time the object **enters** the **Off State**.
 	 *
@@ -449,6 +927,42 @@ public:
 	 * @param newFnWhnTrnOn: function pointer to the function intended to be called when the object **enters** the **On State**. Passing **nullptr** as parameter deactivates the function execution mechanism.
 	 */
 	void setFnWhnTrnOnPtr(void (*newFnWhnTrnOn)());
+	/**
+	 * @brief Sets a timer input capture digital filter for the object's pin, and the edges capture as input level source
+	 *
+	 * The timer channel connected to the MPB pin is configured to capture both edges through it's input digital filter (ICxF): an edge is captured only after the input kept the new level for the filter length, so the glitches shorter than the filter length are rejected by hardware. Each captured edge updates the object's input level and restarts it's polling timer, that is kept stopped while the input is stable and nothing is pending, as in the EXTI triggered mode (see setExtiTrgrd(const bool)). The software debouncing of the object is skipped, unless swDbnc is set: only the start delay and the state machine logic are resolved by software.
+	 *
+	 * The filter length is selected as the shortest available filter not shorter than the requested length, see icFltrFor(const uint32_t&, const uint8_t&, const unsigned long int&). The filter sampling clock is derived from the timer clock and the timer clock division setting (Init.ClockDivision) only, so the longest available filter is 8 samples at a 1/128 of the timer clock: about 12 microseconds for an 84 MHz timer clock. That length rejects the bounces of solid state and optical inputs, and the fast glitches of electrically noisy lines, but not the milliseconds long bounces of mechanical contacts, that must keep the software debouncing by setting swDbnc.
+	 *
+	 * @param timHndl Pointer to the HAL handle of the timer, initialized by the application for input capture (HAL_TIM_IC_Init()), with the MPB pin configured as the channel alternate function input by the timer MSP initialization. NULL to remove a set hardware filter, restoring the MPB pin reading and the software debouncing.
+	 * @param timChnl The timer channel connected to the MPB pin (TIM_CHANNEL_1 to TIM_CHANNEL_4).
+	 * @param timClkHz The timer kernel clock frequency, in Hz.
+	 * @param fltrTmNs The requested filter length, in nanoseconds.
+	 * @param swDbnc (Optional) Keeps the software debouncing of the object. Default value is false.
+	 *
+	 * @return Boolean indicating if the setting was successful.
+	 * @retval true: the filter and capture were set, or removed.
+	 * @retval false: the object has no valid pin, is serviced by a MPBttnPollGrp, has an input source, is in EXTI triggered mode, already has a hardware filter set, the parameters are invalid, the capture objects list is full, or the timer channel configuration failed. No change was made.
+	 *
+	 * @note The application must route the timer capture interrupts to the HAL (TIMx_IRQHandler() invoking HAL_TIM_IRQHandler()) and the HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef*) must invoke mpbCptrCallback(TIM_HandleTypeDef*).
+	 * @note The captured edges times are used as the press and release timestamps only if the timer is a free running 32 bits timer counting at 1 MHz, see getLastPrssTmStmp().
+	 */
+	bool setHwFltr(TIM_HandleTypeDef* timHndl, const uint32_t &timChnl, const uint32_t &timClkHz, const unsigned long int &fltrTmNs, const bool &swDbnc = false);
+	/**
+	 * @brief Sets an input source to provide the MPB input level instead of the object's GPIO pin
+	 *
+	 * The input of the object is read from the input source refreshed values (see MPBttnInptSrc) instead of reading the GPIO pin. The pulledUp and typeNO attributes keep their meaning, being applied to the input source provided level to calculate if the MPB is pressed. The object might be instantiated with an invalid pin (_InvalidPinNum) when it's input is to be provided by an input source, as no GPIO pin will be configured.
+	 *
+	 * @param newInptSrc Pointer to the input source object providing the input level, nullptr to restore the reading of the object's GPIO pin.
+	 * @param newInptId Identification of the input in the input source.
+	 *
+	 * @return Boolean indicating if the setting was successful.
+	 * @retval true: the input source was set.
+	 * @retval false: the object is being updated (begin(const unsigned long int) was invoked, or the object is serviced by a MPBttnPollGrp), the object is in EXTI triggered mode, or the input id is out of the input source range. No change was made.
+	 *
+	 * @note The input source must be set before the object's updating is started, and the EXTI triggered mode is not available for an object with an input source, as the input source inputs generate no EXTI interrupts.
+	 */
+	bool setInptSrc(MPBttnInptSrc* newInptSrc, const uint16_t &newInptId);
    /**
 	 * @brief Sets the value of the **isOnDisabled** flag.
 	 *
@@ -460,6 +974,18 @@ public:
     * @warning If the method is invoked while the object is disabled, and the **isOnDisabled** attribute flag is changed, then the **isOn** attribute flag will have to change accordingly. Changing the **isOn** flag value implies that **all** the implemented mechanisms related to the change of the **isOn** attribute flag value will be invoked.
     */
    void setIsOnDisabled(const bool &newIsOnDisabled);
+	/**
+	 * @brief Sets the minimum On time of the object
+	 *
+	 * A valid press shorter than the time a consumer takes between reads of the isOn flag is missed by the consumer. With a minimum On time set, the object kept in the **On State** for shorter than the minimum On time when the valid release is detected is kept On until the minimum On time -counted from the moment it entered the **On State**- is completed, so the On pulse is stretched for slow consumers to read it. A new valid press detected while the pulse is being stretched keeps the object On, restarting the count for the new press.
+	 *
+	 * The pulse stretching end is a deadline (see getNxtDdln()), so objects in EXTI triggered mode, in adaptive polling mode or dormant in a MPBttnPollGrp with a timing wheel are updated when the minimum On time expires, with no polling in between.
+	 *
+	 * @param newMinOnTm The minimum On time in milliseconds, a 0 value disables the pulse stretching.
+	 *
+	 * @note The minimum On time applies to the objects of the classes using the DbncdMPBttn state machine (DbncdMPBttn and DbncdDlydMPBttn), the latched and voidable classes keep their own On State timing.
+	 */
+	void setMinOnTm(const unsigned long int &newMinOnTm);
    /**
 	 * @brief Sets the value of the attribute flag indicating if a change took place in any of the output attribute flags (IsOn included).
 	 *
@@ -593,7 +1119,8 @@ protected:
 	volatile bool _validUnlatchPend{false};
 	volatile bool _validUnlatchRlsPend{false};
 
-	static void mpbPollCallback(TimerHandle_t mpbTmrCbArg);
+	virtual bool _isStbl();
+	virtual void mpbPollUpd();
 	virtual void stDisabled_In(){};
    virtual void stDisabled_Out(){};
 	virtual void stLtchNVUP_Do(){};
@@ -620,10 +1147,6 @@ public:
 	 * For the rest of the parameters see DbncdMPBttn(GPIO_TypeDef*, const uint16_t, const bool, const bool, const unsigned long int)
 	 */
    LtchMPBttn(gpioPinId_t mpbttnPinStrct, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0, const unsigned long int &strtDelay = 0);
-   /**
-	 * @brief See DbncdMPBttn::begin(const unsigned long int)
-    */
-	virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
 	/**
 	 * @brief See 	DbncdMPBttn::clrStatus(bool)
 	 */
@@ -748,6 +1271,7 @@ protected:
     unsigned long int _srvcTime {};
     unsigned long int _srvcTimerStrt{0};
 
+    virtual bool _isTmdSttPend();
     virtual void stOffNotVPP_Out();
     virtual void stOffVPP_Out();
     virtual void updValidUnlatchStatus();
@@ -773,6 +1297,12 @@ public:
      * @brief see DbncdMPBttn::clrStatus(bool)
      */
     void clrStatus(bool clrIsOn = true);
+    /**
+     * @brief See DbncdMPBttn::getNxtDdln()
+     *
+     * Adds the end of the Service Time to the deadlines computed.
+     */
+    virtual const unsigned long int getNxtDdln() const;
     /**
      * @brief Returns the configured Service Time.
      *
@@ -830,7 +1360,8 @@ protected:
 	bool _validPilotSetPend{false};
 	bool _validPilotResetPend{false};
 
-   static void mpbPollCallback(TimerHandle_t mpbTmrCbArg);
+	virtual bool _isStbl();
+	virtual void mpbPollUpd();
 	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
 	virtual void stDisabled_In();
 	virtual void stLtchNVUP_Do();
@@ -860,10 +1391,6 @@ public:
 	 * For the rest of the parameters see TmLtchMPBttn(gpioPinId_t, const unsigned long int, const bool, const bool, const unsigned long int, const unsigned long int)
 	 */
 	HntdTmLtchMPBttn(gpioPinId_t mpbttnPinStrct, const unsigned long int &actTime, const unsigned int &wrnngPrctg = 0, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0, const unsigned long int &strtDelay = 0);
-	/**
-	 * @brief See DbncdMPBttn::begin(const unsigned long int)
-	 */
-	virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
    /**
     * @brief see DbncdMPBttn::clrStatus(bool)
     */
@@ -912,6 +1439,12 @@ public:
 	 * @warning The function code execution will become part of the list of procedures the object executes when it enters the **Warning On State**, including the modification of affected attribute flags. Making the function code too time-demanding must be handled with care, using alternative execution schemes, for example the function might resume a independent task that suspends itself at the end of its code, to let a new function calling event resume it once again.
 	 */
 	fncPtrType  getFnWhnTrnOnWrnng();
+	/**
+	 * @brief See DbncdMPBttn::getNxtDdln()
+	 *
+	 * Adds the start of the Warning period to the deadlines computed.
+	 */
+	virtual const unsigned long int getNxtDdln() const;
 	/**
 	 * @brief Returns the current value of the pilotOn attribute flag.
 	 *
@@ -1008,6 +1541,7 @@ protected:
     DbncdDlydMPBttn* _unLtchBttn {nullptr};
     bool _xtrnUnltchPRlsCcl {false};
 
+ 	virtual bool _isTmdSttPend();
  	virtual void stOffNVURP_Do();
  	virtual void updValidUnlatchStatus();
 public:
@@ -1124,7 +1658,9 @@ protected:
 	void (*_fnWhnTrnOnScndry)() {nullptr};
 	TaskHandle_t _taskWhileOnScndryHndl{NULL};
 
-	static void mpbPollCallback(TimerHandle_t mpbTmrCbArg);
+	virtual bool _isStbl();
+	virtual bool _isTmdSttPend();
+	virtual void mpbPollUpd();
    virtual void stDisabled_In(){};
    virtual void stOnEndScndMod_Out(){};
    virtual void stOnScndMod_Do() = 0;
@@ -1152,11 +1688,6 @@ public:
 	 * @brief Virtual destructor
     */
 	~DblActnLtchMPBttn();
-	/**
-	 *
-	 * @brief See DbncdMPBttn::begin(const unsigned long int)
-	 */
-   virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
 	/**
 	 * @brief See DbncddMPBttn::clrStatus(bool)
 	 */
@@ -1187,6 +1718,12 @@ public:
     * @return The current value of the isOnScndry flag.
     */
    bool getIsOnScndry();
+	/**
+	 * @brief See DbncdMPBttn::getNxtDdln()
+	 *
+	 * Adds the activation of the second mode, while the MPB is kept pressed, to the deadlines computed.
+	 */
+	virtual const unsigned long int getNxtDdln() const;
 	/**
 	 * @brief Returns the current value of the scndModActvDly class attribute.
 	 *
@@ -1608,7 +2145,8 @@ protected:
    bool _validVoidPend{false};
    bool _validUnvoidPend{false};
 
-   static void mpbPollCallback(TimerHandle_t mpbTmrCb);
+   virtual bool _isStbl();
+   virtual void mpbPollUpd();
    uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
    bool setVoided(const bool &newVoidValue);
    virtual void stDisabled_In();
@@ -1743,10 +2281,11 @@ protected:
     unsigned long int _voidTime;
     unsigned long int _voidTmrStrt{0};
 
+    virtual bool _isTmdSttPend();
     virtual void stOffNotVPP_In();
     virtual void stOffVddNVUP_Do();	//This provides a setting point for calculating the _validUnvoidPend
     virtual void stOffVPP_Do();	// This provides a setting point for the voiding mechanism to be started
-    bool updIsPressed();
+    virtual bool updIsPressed();
     virtual bool updVoidStatus();
 public:
     /**
@@ -1769,14 +2308,16 @@ public:
      * @brief Class virtual destructor
      */
     virtual ~TmVdblMPBttn();
-    /**
-     * @brief See DbncdMPBttn::begin(const unsigned long int)
-     */
-    virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
     /**
      * @brief See DbncdMPBttn::clrStatus(bool)
      */
     void clrStatus();
+    /**
+     * @brief See DbncdMPBttn::getNxtDdln()
+     *
+     * Adds the end of the Void Time to the deadlines computed.
+     */
+    virtual const unsigned long int getNxtDdln() const;
     /**
      * @brief Returns the voidTime attribute current value.
      *
@@ -1837,10 +2378,1461 @@ public:
     * @brief Class virtual destructor
     */
    virtual ~SnglSrvcVdblMPBttn();
-   /**
-    * @brief See DbncdMPBttn::begin(const unsigned long int)
-    */
-   virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Abstract class, models an input source providing the input levels for MPB objects (**MPB-IS**)
+ *
+ * The MPB objects read their own GPIO pin by default, an input source provides instead the levels of a set of inputs read by other means (chained shift registers, I/O expanders, keys matrices, etc.) so that the MPB objects can be used with inputs not directly connected to the MCU pins. Each MPB object is attached to one of the input source inputs by setInptSrc(MPBttnInptSrc*, const uint16_t&).
+ *
+ * All the inputs of the input source are read in a single transfer by a refresh, and the read values are kept to be served to the attached objects. An object updated by it's own timer requests the refresh before it's update, only the first request of each tick executing the transfer, while a MPBttnPollGrp refreshes each input source of it's registered objects once at the start of each scan, so the many objects attached to an input source produce a single transfer per scan.
+ *
+ * @note The subclasses must implement the input reading transfer in _rdInpts(), and the getInptLvl(const uint16_t&) and getInptsQty() methods.
+ *
+ * @class MPBttnInptSrc
+ */
+class MPBttnInptSrc{
+protected:
+	SemaphoreHandle_t _inptSrcMtx{NULL};
+	unsigned long int _rfrshsCnt{0};
+	bool _rfrshd{false};
+	TickType_t _rfrshTck{0};
+
+	virtual bool _rdInpts() = 0;
+public:
+	/**
+	 * @brief Class constructor
+	 */
+	MPBttnInptSrc();
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MPBttnInptSrc();
+	/**
+	 * @brief Returns the level of an input, as read by the last refresh
+	 *
+	 * @param inptId Identification of the input in the input source.
+	 *
+	 * @return The input level, true for high level. An out of range input id returns false.
+	 */
+	virtual bool getInptLvl(const uint16_t &inptId) const = 0;
+	/**
+	 * @brief Returns the quantity of inputs provided by the input source
+	 */
+	virtual const uint16_t getInptsQty() const = 0;
+	/**
+	 * @brief Returns the quantity of input reading transfers executed by the input source
+	 */
+	const unsigned long int getRfrshsCnt() const;
+	/**
+	 * @brief Refreshes the input levels, executing the input reading transfer
+	 *
+	 * The transfer is executed only once per tick, further invocations in the same tick keep the values read by the first one.
+	 *
+	 * @param frcRfrsh (Optional) Forces the transfer execution even if the values were already refreshed in the current tick.
+	 *
+	 * @return Boolean indicating if the input levels are refreshed.
+	 * @retval true: the transfer was executed successfully, or the values were already refreshed in the current tick.
+	 * @retval false: the transfer failed, or a refresh was in progress in another task.
+	 *
+	 * @note The transfer might use blocking peripheral services, so the method must not be invoked from a critical section or an ISR.
+	 */
+	bool rfrsh(const bool &frcRfrsh = false);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models an input source with software set input levels (**MPB-LIS**)
+ *
+ * The input levels are set by setInptLvl(const uint16_t&, const bool&) and served to the attached MPB objects after the next refresh, as the levels read from hardware would be. The class lets the attached MPB objects be exercised with simulated inputs, with no input hardware involved.
+ *
+ * @class LpbckInptSrc
+ */
+class LpbckInptSrc: public MPBttnInptSrc{
+protected:
+	std::vector<uint8_t> _inptsBuff{};
+	std::vector<uint8_t> _inptsLvls{};
+	uint16_t _inptsQty{0};
+
+	virtual bool _rdInpts();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param inptsQty Quantity of inputs provided by the input source.
+	 */
+	LpbckInptSrc(const uint16_t &inptsQty);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~LpbckInptSrc();
+	/**
+	 * @brief See MPBttnInptSrc::getInptLvl(const uint16_t&)
+	 */
+	virtual bool getInptLvl(const uint16_t &inptId) const;
+	/**
+	 * @brief See MPBttnInptSrc::getInptsQty()
+	 */
+	virtual const uint16_t getInptsQty() const;
+	/**
+	 * @brief Sets the level of an input, to be served after the next refresh
+	 *
+	 * @param inptId Identification of the input in the input source.
+	 * @param newInptLvl New level for the input, true for high level.
+	 *
+	 * @return Boolean indicating if the setting was successful.
+	 * @retval true: the input level was set.
+	 * @retval false: the input id is out of range.
+	 */
+	bool setInptLvl(const uint16_t &inptId, const bool &newInptLvl);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models an input source of chained 74HC165 parallel in, serial out shift registers (**MPB-SRIS**)
+ *
+ * The chained registers parallel inputs are latched by a low pulse in the SH/LD pin, and the chain is read by a single SPI receive transfer of one byte per chip. The chip closest to the MCU (it's QH output connected to the SPI MISO line) is the first byte received, so the input id of each register input is chip * 8 + k for the Dk input of the chip, with chip 0 being the one closest to the MCU.
+ *
+ * The SPI peripheral must be configured by the application as master, receive only or full duplex, 8 bits data size, MSB first, CPOL = 0 and CPHA = 1 edge (the 74HC165 shifts on the clock rising edge), and the chip CLK INH pin tied low. As the MSB is received first, the D7 input of each chip is the bit 7 of it's byte.
+ *
+ * With the DMA option the SPI transfer is started by the refresh and collected by the next one, freeing the CPU from the transfer time at the cost of serving the values one refresh late.
+ *
+ * @class ShftRgstrInptSrc
+ */
+class ShftRgstrInptSrc: public MPBttnInptSrc{
+protected:
+	const uint32_t _spiTmOut{2};
+	volatile bool _dmaRxPend{false};
+	std::vector<uint8_t> _inptsBuff{};
+	uint16_t _inptsQty{0};
+	gpioPinId_t _ldPin{};
+	std::vector<uint8_t> _rxBuff{};
+	SPI_HandleTypeDef* _spiHndl{NULL};
+	bool _useDma{false};
+
+	void _ldInpts();
+	virtual bool _rdInpts();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param spiHndl Pointer to the HAL handle of the SPI peripheral, already configured by the application.
+	 * @param ldPin GPIO port and Pin connected to the registers SH/LD pin, configured as output by the constructor.
+	 * @param chipsQty Quantity of chained registers.
+	 * @param useDma (Optional) Indicates if the SPI transfer is done by DMA (the DMA channel must be linked to the SPI handle by the application). Default value is false.
+	 */
+	ShftRgstrInptSrc(SPI_HandleTypeDef* spiHndl, gpioPinId_t ldPin, const uint8_t &chipsQty, const bool &useDma = false);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~ShftRgstrInptSrc();
+	/**
+	 * @brief See MPBttnInptSrc::getInptLvl(const uint16_t&)
+	 */
+	virtual bool getInptLvl(const uint16_t &inptId) const;
+	/**
+	 * @brief See MPBttnInptSrc::getInptsQty()
+	 */
+	virtual const uint16_t getInptsQty() const;
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models an input source of an I2C port expander, driven by the expander's interrupt line (**MPB-I2CIS**)
+ *
+ * Register based expanders (MCP23017 style) and register-less quasi-bidirectional expanders (PCF8575/PCF8574 style) are supported. All the expander inputs are read by a single bulk read transaction (both ports of a 16 inputs expander in the same transaction), and the read values are served to all the MPB objects attached to the expander inputs, input id k being the bit k of the expander's ports, port A (or P0x) inputs being ids 0 to 7.
+ *
+ * When the expander's INT pin is connected to a MCU pin the refreshes keep the bus idle while the INT line is inactive, a bulk read is executed only when the expander signals an input change. The INT line might also be routed to an EXTI line by the application, invoking xpndrIntCallback() from the HAL_GPIO_EXTI_Callback(uint16_t), so the short lived INT assertions of the register-less expanders are latched until the next refresh. With no INT pin the inputs are read by every refresh.
+ *
+ * @note The I2C peripheral must be configured by the application, and the INT pin port clock enabled, before the object is instantiated.
+ *
+ * @class I2cXpndrInptSrc
+ */
+class I2cXpndrInptSrc: public MPBttnInptSrc{
+protected:
+	const uint32_t _i2cTmOut{2};
+	const uint8_t _mcpGpioRegAddr{0x12};
+	const uint8_t _mcpGpintenRegAddr{0x04};
+	const uint8_t _mcpGppuRegAddr{0x0C};
+	const uint8_t _mcpIoconRegAddr{0x0A};
+
+	unsigned long int _busTrnsctnsCnt{0};
+	uint8_t _devAddr{0};
+	bool _hasInt{false};
+	I2C_HandleTypeDef* _i2cHndl{NULL};
+	uint16_t _inptsLvls{0xFFFF};
+	uint8_t _inptsQty{16};
+	volatile bool _intPend{true};
+	gpioPinId_t _intPin{NULL, _InvalidPinNum};
+	bool _regBsd{true};
+
+	virtual bool _isIntActv();
+	virtual bool _rdInpts();
+	virtual bool _xpndrRd(uint8_t* rdBuff, const uint8_t &rdQty);
+	virtual bool _xpndrWr(const uint8_t &regAddr, uint8_t* wrBuff, const uint8_t &wrQty);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param i2cHndl Pointer to the HAL handle of the I2C peripheral, already configured by the application.
+	 * @param devAddr 7 bits I2C address of the expander.
+	 * @param regBsd (Optional) Indicates if the expander is register based (MCP23017 style, true, default value) or register-less (PCF8575 style, false).
+	 * @param inptsQty (Optional) Quantity of inputs of the expander, 8 or 16 (default value).
+	 * @param intPin (Optional) GPIO port and Pin connected to the expander's INT line, configured as input with pull-up by the constructor. The default value indicates no INT pin is connected.
+	 */
+	I2cXpndrInptSrc(I2C_HandleTypeDef* i2cHndl, const uint8_t &devAddr, const bool &regBsd = true, const uint8_t &inptsQty = 16, gpioPinId_t intPin = {NULL, _InvalidPinNum});
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~I2cXpndrInptSrc();
+	/**
+	 * @brief Configures the expander pins as inputs and executes the first inputs read
+	 *
+	 * For register based expanders the pull-ups of all the pins are enabled, and the interrupt on change is enabled for all the pins with the INT outputs mirrored and open drain, so a single INT line signals the changes of both ports. For register-less expanders all the pins are written high, as needed to use them as inputs.
+	 *
+	 * @return Boolean indicating if the configuration and first read were successful.
+	 */
+	bool begin();
+	/**
+	 * @brief Returns the quantity of I2C transactions executed with the expander
+	 *
+	 * The value, compared to the refreshes quantity, gives the measure of the bus idle time obtained from the INT line.
+	 */
+	const unsigned long int getBusTrnsctnsCnt() const;
+	/**
+	 * @brief See MPBttnInptSrc::getInptLvl(const uint16_t&)
+	 */
+	virtual bool getInptLvl(const uint16_t &inptId) const;
+	/**
+	 * @brief See MPBttnInptSrc::getInptsQty()
+	 */
+	virtual const uint16_t getInptsQty() const;
+	/**
+	 * @brief Latches the expander's INT line activation, to be served by the next refresh
+	 *
+	 * @note The method is safe to be invoked from an ISR.
+	 */
+	void xpndrIntCallback();
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a simulated I2C port expander input source (**MPB-SI2CIS**)
+ *
+ * The bus transactions of the I2cXpndrInptSrc class are replaced by a simulated register based expander: the input levels are set by setInptLvl(const uint16_t&, const bool&), a level change activates the simulated INT line, and the bulk read clears it, as the MCP23017 does. The class lets the INT driven refreshes and the bus transactions batching be exercised with no expander hardware involved.
+ *
+ * @class SimI2cXpndrInptSrc
+ */
+class SimI2cXpndrInptSrc: public I2cXpndrInptSrc{
+protected:
+	volatile bool _simInt{false};
+	uint16_t _simLvls{0xFFFF};
+
+	virtual bool _isIntActv();
+	virtual bool _xpndrRd(uint8_t* rdBuff, const uint8_t &rdQty);
+	virtual bool _xpndrWr(const uint8_t &regAddr, uint8_t* wrBuff, const uint8_t &wrQty);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param inptsQty (Optional) Quantity of inputs of the simulated expander, 8 or 16 (default value).
+	 */
+	SimI2cXpndrInptSrc(const uint8_t &inptsQty = 16);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~SimI2cXpndrInptSrc();
+	/**
+	 * @brief Sets the level of a simulated expander input
+	 *
+	 * The simulated pins are pulled up, so the inputs are high until set otherwise. A level change activates the simulated INT line.
+	 *
+	 * @param inptId Identification of the input in the input source.
+	 * @param newInptLvl New level for the input, true for high level.
+	 *
+	 * @return Boolean indicating if the setting was successful.
+	 * @retval true: the input level was set.
+	 * @retval false: the input id is out of range.
+	 */
+	bool setInptLvl(const uint16_t &inptId, const bool &newInptLvl);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models an input source of a keys matrix (keypad) scanner (**MPB-KMIS**)
+ *
+ * The keys of a matrix of up to 8 rows by 8 columns are provided as inputs for MPB objects, so each key might behave as any of the MPB classes. The rows are driven low one at a time (open drain outputs), and the columns, all in the same GPIO port with pull-ups, are read with a single port read per row, so the whole matrix costs a single scan per refresh. The input id of the key at row r and column c is r * colsQty + c, the column c being the c-th lowest pin of the columns pins mask. As the columns are pulled up a pressed key reads as a low level, so the attached MPB objects are set as pulledUp, typeNO.
+ *
+ * A matrix with no diodes in series with the keys produces ghosting: when three keys in the corners of a rectangle are pressed, the fourth key reads as pressed too. Whenever two rows read two or more common pressed columns the pressed state of the keys in the rectangle can't be resolved, so those keys keep the levels of the last scan they were resolved in, and the ghosting detection is flagged (see getGhstngDtctd() and getGhstngCnt()). The detection is skipped for matrices with diodes, as they don't ghost.
+ *
+ * @class KeyMtrxInptSrc
+ */
+class KeyMtrxInptSrc: public MPBttnInptSrc{
+protected:
+	static const uint8_t _mtrxMaxLns {8};
+
+	uint8_t _colsPinNum[_mtrxMaxLns]{};
+	GPIO_TypeDef* _colsPort{NULL};
+	uint8_t _colsQty{0};
+	bool _ghstngDtctd{false};
+	unsigned long int _ghstngCnt{0};
+	bool _hasDiodes{false};
+	uint8_t _keysPrssd[_mtrxMaxLns]{};
+	gpioPinId_t _rowsPins[_mtrxMaxLns]{};
+	uint8_t _rowsQty{0};
+	uint8_t _sttlLps{16};
+
+	virtual bool _rdInpts();
+	virtual uint8_t _rdRowCols(const uint8_t &row);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param rowsPins Array of the GPIO port and Pin of each row line, configured as open drain outputs by the constructor.
+	 * @param rowsQty Quantity of rows of the matrix, up to 8.
+	 * @param colsPort GPIO port of the columns lines.
+	 * @param colsPinsMsk Mask of the columns lines pins of the colsPort, configured as inputs with pull-up by the constructor. The quantity of columns is the quantity of pins in the mask, up to 8.
+	 * @param hasDiodes (Optional) Indicates if the matrix keys have diodes in series, so no ghosting detection is needed. Default value is false.
+	 *
+	 * @note The rows pins and columns port clocks must be enabled by the application before the object is instantiated.
+	 */
+	KeyMtrxInptSrc(gpioPinId_t* rowsPins, const uint8_t &rowsQty, GPIO_TypeDef* colsPort, const uint16_t &colsPinsMsk, const bool &hasDiodes = false);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~KeyMtrxInptSrc();
+	/**
+	 * @brief Returns the quantity of columns of the matrix
+	 */
+	const uint8_t getColsQty() const;
+	/**
+	 * @brief Returns the ghosting detection flag of the last scan
+	 *
+	 * @retval true: the last scan found unresolvable keys, that kept their previous levels.
+	 */
+	const bool getGhstngDtctd() const;
+	/**
+	 * @brief Returns the quantity of scans with ghosting detected
+	 */
+	const unsigned long int getGhstngCnt() const;
+	/**
+	 * @brief See MPBttnInptSrc::getInptLvl(const uint16_t&)
+	 */
+	virtual bool getInptLvl(const uint16_t &inptId) const;
+	/**
+	 * @brief See MPBttnInptSrc::getInptsQty()
+	 */
+	virtual const uint16_t getInptsQty() const;
+	/**
+	 * @brief Returns the quantity of rows of the matrix
+	 */
+	const uint8_t getRowsQty() const;
+	/**
+	 * @brief Sets the settling wait between driving a row and reading the columns
+	 *
+	 * The columns pull-ups must charge the lines capacitance after the previous row is released, long or shielded lines might need a longer wait.
+	 *
+	 * @param newSttlLps Quantity of busy wait loops, default value is 16.
+	 */
+	void setSttlLps(const uint8_t &newSttlLps);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a simulated keys matrix input source (**MPB-SKMIS**)
+ *
+ * The rows driving and columns reading of the KeyMtrxInptSrc class are replaced by a simulated matrix of keys, whose pressed state is set by setKeyPrssd(const uint8_t&, const uint8_t&, const bool&). The simulated matrix reproduces the electrical behavior of a matrix with no diodes, where the pressed keys connect rows and columns so that ghost keys read as pressed, letting the ghosting detection be exercised with no keypad hardware involved.
+ *
+ * @class SimKeyMtrxInptSrc
+ */
+class SimKeyMtrxInptSrc: public KeyMtrxInptSrc{
+protected:
+	uint8_t _simKeysPrssd[_mtrxMaxLns]{};
+
+	virtual uint8_t _rdRowCols(const uint8_t &row);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param rowsQty Quantity of rows of the simulated matrix, up to 8.
+	 * @param colsQty Quantity of columns of the simulated matrix, up to 8.
+	 * @param hasDiodes (Optional) Indicates if the simulated matrix keys have diodes in series. Default value is false.
+	 */
+	SimKeyMtrxInptSrc(const uint8_t &rowsQty, const uint8_t &colsQty, const bool &hasDiodes = false);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~SimKeyMtrxInptSrc();
+	/**
+	 * @brief Sets the pressed state of a simulated matrix key
+	 *
+	 * @param row Row of the key.
+	 * @param col Column of the key.
+	 * @param newKeyPrssd New pressed state of the key.
+	 *
+	 * @return Boolean indicating if the setting was successful.
+	 * @retval false: the row or column are out of range.
+	 */
+	bool setKeyPrssd(const uint8_t &row, const uint8_t &col, const bool &newKeyPrssd);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models an input source of several MPBs sharing an analog line through a resistor ladder (**MPB-ALIS**)
+ *
+ * Each MPB of the ladder produces a different voltage in the analog line when pressed. The line is converted by an ADC in continuous mode, the conversions being transferred by DMA into a circular buffer. Each refresh averages the buffer samples and classifies the mean value against the configured voltage windows (see addWndw(const uint16_t&, const uint16_t&)), so the classification is done once per refresh for all the ladder MPBs. Each window is an input of the source, the input id being the window index in the order of addition.
+ *
+ * A hysteresis band is applied to the active window limits (see setHyst(const uint16_t&)), so a value near a window limit doesn't make the input chatter: an inactive window must get a value inside it's limits to be activated, an active window keeps active while the value is inside it's limits widened by the hysteresis band. At most one window is active at a time. As the ladder MPBs are usually connected to pull the line from an idle level, the active window input reads as a low level, so the attached MPB objects are set as pulledUp, typeNO.
+ *
+ * The feedSmplsBtch(const uint16_t*, const std::size_t&) method loads samples into the conversions buffer, it's made public to let the input source be fed by other means, as a simulated ADC in a host test harness.
+ *
+ * @class AdcLddrInptSrc
+ */
+class AdcLddrInptSrc: public MPBttnInptSrc{
+protected:
+	static const uint8_t _wndwsMaxQty {8};
+	static const uint8_t _noActvWndw {0xFF};
+
+	uint8_t _actvWndw{_noActvWndw};
+	ADC_HandleTypeDef* _adcHndl{NULL};
+	uint16_t _btchMean{0};
+	uint16_t _hyst{0};
+	std::vector<uint16_t> _smplsBuff{};
+	uint16_t _wndwsHghLmt[_wndwsMaxQty]{};
+	uint16_t _wndwsLowLmt[_wndwsMaxQty]{};
+	uint8_t _wndwsQty{0};
+
+	virtual bool _rdInpts();
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param adcHndl Pointer to the HAL handle of the ADC, configured by the application for continuous conversions of the ladder channel with a circular DMA. NULL for an input source fed only by feedSmplsBtch(const uint16_t*, const std::size_t&).
+	 * @param smplsBuffLen (Optional) Length of the conversions circular buffer, default value is 16.
+	 */
+	AdcLddrInptSrc(ADC_HandleTypeDef* adcHndl, const uint16_t &smplsBuffLen = 16);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~AdcLddrInptSrc();
+	/**
+	 * @brief Adds a voltage window, corresponding to a ladder MPB
+	 *
+	 * @param lowLmt Window low limit, in ADC counts.
+	 * @param hghLmt Window high limit, in ADC counts.
+	 *
+	 * @return Boolean indicating if the window was added.
+	 * @retval false: the limits are inverted, the window overlaps an added window, or the windows quantity limit (8) is reached.
+	 */
+	bool addWndw(const uint16_t &lowLmt, const uint16_t &hghLmt);
+	/**
+	 * @brief Starts the continuous conversions DMA transfers into the conversions buffer
+	 *
+	 * @return Boolean indicating if the conversions were started.
+	 */
+	bool begin();
+	/**
+	 * @brief Stops the continuous conversions DMA transfers
+	 *
+	 * @return Boolean indicating if the conversions were stopped.
+	 */
+	bool end();
+	/**
+	 * @brief Feeds samples into the conversions buffer
+	 *
+	 * @param smplsBtch Pointer to the first sample of the batch.
+	 * @param smplsQty Quantity of samples in the batch, the samples exceeding the buffer length are ignored.
+	 */
+	void feedSmplsBtch(const uint16_t* smplsBtch, const std::size_t &smplsQty);
+	/**
+	 * @brief Returns the mean value of the conversions buffer, as classified by the last refresh
+	 */
+	const uint16_t getBtchMean() const;
+	/**
+	 * @brief See MPBttnInptSrc::getInptLvl(const uint16_t&)
+	 */
+	virtual bool getInptLvl(const uint16_t &inptId) const;
+	/**
+	 * @brief See MPBttnInptSrc::getInptsQty()
+	 */
+	virtual const uint16_t getInptsQty() const;
+	/**
+	 * @brief Sets the hysteresis band applied to the active window limits
+	 *
+	 * @param newHyst Hysteresis band, in ADC counts. Default value is 0.
+	 */
+	void setHyst(const uint16_t &newHyst);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a Hierarchical Timer Wheel, a deadlines container with O(1) schedule and cancel operations (**MPB-TW**)
+ *
+ * The time based features of the MPB classes (time latched service, warning and pilot signals, secondary mode activation delay, voiding time) produce deadlines that are far apart from each other and from the polling period. Checking every object in every scan to find out if one of it's deadlines expired makes the work of each scan proportional to the number of objects. The Timer Wheel keeps those deadlines in slot lists so that advancing the wheel time only touches the deadlines expiring.
+ *
+ * The wheel has 3 levels of 64 slots each, with a resolution of 1 millisecond: the first level holds the deadlines expiring in the next 64 milliseconds, the second level the deadlines expiring in the next 4.096 seconds, and the third level the ones expiring in the next 262.144 seconds. As the wheel time advances the slots of the upper levels are cascaded down to the lower ones. Deadlines further away than the third level range are kept in the last reachable slot and rescheduled when the slot is cascaded, so there's no limit to the deadlines time range.
+ *
+ * The nodes are kept in the MPB objects (see MpbTmrWhlNd_t), the wheel never allocates memory.
+ *
+ * @note The class provides no concurrency protection, it's meant to be used by a single owner, as MPBttnPollGrp does from it's scans.
+ *
+ * @class MPBttnTmrWhl
+ */
+class MPBttnTmrWhl{
+protected:
+	static const uint8_t _whlLvls {3};
+	static const uint8_t _whlSlotBits {6};
+	static const uint8_t _whlSlots {1 << _whlSlotBits};
+
+	unsigned long int _curTm{0};
+	bool _curTmSet{false};
+	std::size_t _ndsQty{0};
+	MpbTmrWhlNd_t* _whlSlotsLst[_whlLvls][_whlSlots]{};
+
+	void _cscdSlot(const uint8_t &whlLvl, const uint8_t &whlSlot);
+	void _lnkNd(MpbTmrWhlNd_t* whlNd);
+public:
+	/**
+	 * @brief Default class constructor
+	 *
+	 */
+	MPBttnTmrWhl();
+	/**
+	 * @brief Advances the wheel time, collecting the expired deadlines
+	 *
+	 * The wheel time is advanced one millisecond at a time up to the newCurTm value, cascading the upper levels slots when needed. If the wheel holds no deadlines the wheel time is set to the new value directly.
+	 *
+	 * @param newCurTm The current time, in milliseconds.
+	 *
+	 * @return A pointer to the first node of the expired deadlines list, linked through their **next** member, or nullptr if no deadline expired. The expired nodes are no longer linked to the wheel.
+	 *
+	 * @note The first invocation only sets the wheel time.
+	 */
+	MpbTmrWhlNd_t* advance(const unsigned long int &newCurTm);
+	/**
+	 * @brief Removes a deadline from the wheel
+	 *
+	 * @param whlNd Pointer to the node to be unlinked. Nodes not linked to the wheel are ignored.
+	 */
+	void cancel(MpbTmrWhlNd_t* whlNd);
+	/**
+	 * @brief Returns the wheel time
+	 *
+	 * @return The time up to which the wheel was advanced, in milliseconds.
+	 */
+	const unsigned long int getCurTm() const;
+	/**
+	 * @brief Returns the number of deadlines held in the wheel
+	 *
+	 * @return The quantity of nodes linked to the wheel.
+	 */
+	const std::size_t getNdsQty() const;
+	/**
+	 * @brief Adds a deadline to the wheel
+	 *
+	 * If the node was already linked to the wheel it's rescheduled to the new deadline.
+	 *
+	 * @param whlNd Pointer to the node to be linked.
+	 * @param expTm The deadline timestamp, in milliseconds. A deadline not later than the wheel time expires in the next wheel time advance.
+	 */
+	void schedule(MpbTmrWhlNd_t* whlNd, const unsigned long int &expTm);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a Poll Group, a single timer servicing the update of many MPB objects (**MPB-PG**)
+ *
+ * Each MPB object started with the begin(const unsigned long int) method creates and starts it's own FreeRTOS software timer, so an application with many MPBs ends with many timers expiring at the same rate, each one with it's own timer command queue traffic and daemon task context switch. The **Poll Group** replaces all those timers by a single one: in each timer expiration the group scans it's list of registered MPB objects, executing for each one of them the same update sequence the object would have executed in it's own timer callback (input reading, debouncing, state machine update and task notification).
+ *
+ * The objects list is protected by a FreeRTOS mutex, so MPB objects might be added to and removed from the group while the group is running. The scan never blocks the timer daemon task waiting for the mutex, if the list is being modified when the timer expires that scan is skipped, and the objects will be updated in the next scan.
+ *
+ * @note An MPB object can be registered in only one Poll Group, and it must not be running it's own timer (see DbncdMPBttn::begin(const unsigned long int)). The objects to be serviced by a Poll Group must be registered in it instead of being started by their begin() method.
+ *
+ * @note For objects depending on another MPB object, as the XtrnUnltchMPBttn does, both the object and the MPB it depends on must be registered in the Poll Group.
+ *
+ * @class MPBttnPollGrp
+ */
+class MPBttnPollGrp{
+protected:
+	static const uint8_t _pollLanesQty {4};
+	static const uint8_t _snpshtPortsMax {11};
+	static const uint8_t _vrtclCntrBitsMax {4};
+
+	struct MpbPortSnpsht_t{
+		GPIO_TypeDef* port;
+		uint32_t idr;
+		uint32_t invMsk;
+		std::size_t mpbsQty;
+		uint32_t vrtclCntr[_vrtclCntrBitsMax];
+	};
+	struct MpbInptSrcRef_t{
+		MPBttnInptSrc* inptSrc;
+		std::size_t mpbsQty;
+	};
+
+	unsigned long int _lanePrssCnt[_pollLanesQty]{};
+	unsigned long int _lanePrssLtncyMaxUs[_pollLanesQty]{};
+	unsigned long long int _lanePrssLtncySumUs[_pollLanesQty]{};
+	unsigned long int _laneScansCnt[_pollLanesQty]{};
+	uint32_t _laneScanPosMaxCycs[_pollLanesQty]{};
+	unsigned long long int _laneScanPosSumCycs[_pollLanesQty]{};
+	std::vector<DbncdMPBttn*> _mpbsLst{};
+	SemaphoreHandle_t _mpbsLstMtx{NULL};
+	unsigned long int _inptRdsCntr{0};
+	std::vector<MpbInptSrcRef_t> _inptSrcsLst{};
+	volatile bool _pausePend{false};
+	TaskHandle_t _pollGrpTaskHndl{NULL};
+	TimerHandle_t _pollGrpTmrHndl{NULL};
+	std::string _pollGrpTmrName{""};
+	unsigned long int _pollDelay{0};
+	uint32_t _prdLastCycCnt{0};
+	unsigned long int _prdMaxUs{0};
+	unsigned long int _prdMinUs{0};
+	bool _prdSttsRsync{true};
+	unsigned long int _prdsCnt{0};
+	unsigned long long int _prdsSumUs{0};
+	MpbPortSnpsht_t _portsSnpsht[_snpshtPortsMax]{};
+	bool _portsSnpshtEnbld{true};
+	unsigned long int _scanInptRdsQty{0};
+	TickType_t _scanPrdTcks{0};
+	std::size_t _scanUpdsQty{0};
+	bool _rtSchdlrActv{false};
+	bool _stggrd{false};
+	std::size_t _stggrdPhs{0};
+	std::size_t _stggrdPhsQty{1};
+	unsigned long int _tckLdMax{0};
+	unsigned long int _tckLdMin{0};
+	unsigned long int _tckLdScansCnt{0};
+	unsigned long long int _tckLdSum{0};
+	MPBttnTmrWhl _tmrWhl{};
+	uint8_t _vrtclCntrBits{2};
+	bool _vrtclDbnc{false};
+
+	static void pollGrpCallback(TimerHandle_t pollGrpTmrCbArg);
+	static void pollGrpTask(void* pollGrpTaskArg);
+	void _attchInptSrc(DbncdMPBttn* mpbObj);
+	void _attchPortSnpsht(DbncdMPBttn* mpbObj);
+	void _dtchInptSrc(DbncdMPBttn* mpbObj);
+	void _dtchPortSnpsht(DbncdMPBttn* mpbObj);
+	std::size_t _lstLdStggrdPhs();
+	void _setScanPrd(const unsigned long int &pollDelayMs);
+	void _setStggrdPhsQty(const std::size_t &phsQty);
+	bool _srvcMPBttn(DbncdMPBttn* mpbObj, const unsigned long int &scanStrtMs, const uint32_t &scanStrtCycCnt);
+	void _updLanePrssLtncy(const uint8_t &lanePrty, const unsigned long int &ltncyUs);
+	void _updLaneScanPos(const uint8_t &lanePrty, const uint32_t &scanPosCycs);
+	void _updVrtclDbnc(MpbPortSnpsht_t &portSnpsht, const uint32_t &portSmpl);
+	void _updPrdStts();
+
+	friend class MPBttnRtSchdlr;
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param pollGrpName (Optional) Base name for the Poll Group's software timer, the "_tmr" suffix will be added to it. Giving each Poll Group a distinct name helps identifying the timers while debugging.
+	 */
+	MPBttnPollGrp(const std::string &pollGrpName = "PollMpbGrp");
+	/**
+	 * @brief Class virtual destructor
+	 *
+	 * Stops and deletes the group's timer, and detaches all the registered MPB objects from the group.
+	 */
+	virtual ~MPBttnPollGrp();
+	/**
+	 * @brief Registers a MPB object to be serviced by the Poll Group
+	 *
+	 * The objects are registered in a priority lane. The objects of the priority lanes (lanePrty > 0) are evaluated at the start of every scan, from the highest priority lane down, and are never subject to the scans staggering (see setStggrd(const bool&)), so their latency is bounded by the work of the objects of the same and higher priority lanes, no matter how many ordinary lane objects are registered and active. The ordinary lane (lanePrty = 0) objects are evaluated after them.
+	 *
+	 * @param mpbObj Pointer to the MPB object to be added to the Poll Group.
+	 * @param lanePrty (Optional) The priority lane of the object, in the range 0 (ordinary lane, default value) to 3 (highest priority lane). Objects as emergency stops or two-hand controls inputs are to be registered in the priority lanes.
+	 *
+	 * @return Boolean indicating if the object was registered in the Poll Group.
+	 * @retval true: the object was registered in the Poll Group, or it was already registered in this group, in which case it's lane is not modified.
+	 * @retval false: the object pointer is nullptr, the lanePrty value is out of range, the object is registered in another Poll Group, the object is running it's own polling timer, the object is set to EXTI triggered mode, or the objects list mutex is not available.
+	 *
+	 * @note The lanes order the work inside a scan, they don't preempt a scan in progress. For inputs that must preempt the rest of the MPBs servicing, register them in a separate Poll Group serviced by a poller task of higher priority (see beginTask(const unsigned long int, const UBaseType_t, const configSTACK_DEPTH_TYPE)).
+	 */
+	virtual bool addMPBttn(DbncdMPBttn* mpbObj, const uint8_t &lanePrty = 0);
+	/**
+	 * @brief Starts the Poll Group's timer, that will periodically update all the registered MPB objects.
+	 *
+	 * @param pollDelayMs (Optional) unsigned long integer (ulong), the time between group scans in milliseconds.
+	 *
+	 * @return Boolean indicating if the Poll Group's timer is running.
+	 * @retval true: the timer was created and started, or it was already running when the method was invoked.
+	 * @retval false: the pollDelayMs value is 0, the poller task is running (see beginTask(const unsigned long int, const UBaseType_t, const configSTACK_DEPTH_TYPE)), or the timer could not be created or started.
+	 */
+	bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
+	/**
+	 * @brief Starts a dedicated poller task, that will periodically update all the registered MPB objects.
+	 *
+	 * The scans executed by the Poll Group's timer run in the FreeRTOS timer daemon task, so any other slow timer callback in the system delays the MPBs sampling, and the functions executed by the MPBs when their state changes (see DbncdMPBttn::setFnWhnTrnOnPtr(void(*)()) and DbncdMPBttn::setFnWhnTrnOffPtr(void(*)())) delay every other timer in the system. The poller task releases the timer daemon from the MPBs servicing: the task scans the registered MPBs with a vTaskDelayUntil() driven period, at a priority set by the developer.
+	 *
+	 * @param pollDelayMs (Optional) unsigned long integer (ulong), the time between group scans in milliseconds.
+	 * @param taskPrty (Optional) The poller task priority.
+	 * @param stackDepth (Optional) The poller task stack depth, in words. The functions executed by the MPBs when their state changes run in the poller task, so it must be sized according to them.
+	 *
+	 * @return Boolean indicating if the poller task is running.
+	 * @retval true: the task was created, or it was already running when the method was invoked.
+	 * @retval false: the pollDelayMs value is 0, the Poll Group's timer is running (see begin(const unsigned long int)), or the task could not be created.
+	 */
+	bool beginTask(const unsigned long int &pollDelayMs = _StdPollDelay, const UBaseType_t &taskPrty = configMAX_PRIORITIES - 1, const configSTACK_DEPTH_TYPE &stackDepth = configMINIMAL_STACK_SIZE * 2);
+	/**
+	 * @brief Stops the Poll Group's timer or poller task and deletes it.
+	 *
+	 * The registered MPB objects are kept in the group, a new begin(const unsigned long int) or beginTask(const unsigned long int, const UBaseType_t, const configSTACK_DEPTH_TYPE) invocation will resume their servicing.
+	 *
+	 * @return Boolean indicating the success of the operation.
+	 * @retval true: the timer or task was stopped and deleted, or there was no timer nor task running.
+	 * @retval false: the timer could not be deleted.
+	 *
+	 * @warning The method must not be invoked from the poller task itself, i.e. from a function executed by a MPB serviced by the group.
+	 */
+	virtual bool end();
+	/**
+	 * @brief Returns the number of MPB objects registered in the Poll Group
+	 *
+	 * @return The quantity of registered MPB objects.
+	 */
+	const std::size_t getMPBttnsQty() const;
+	/**
+	 * @brief Returns the number of MPB objects updated in the last scan
+	 *
+	 * See scanMPBttns() for the conditions that make a scan update a registered object.
+	 *
+	 * @return The quantity of MPB objects updated by the last scan executed.
+	 */
+	const std::size_t getLastScanUpdsQty() const;
+	/**
+	 * @brief Returns the latency measurements of a priority lane
+	 *
+	 * The measurements are restarted when the scans are started, or by the resetLanesLtncy() method. See MpbPollLaneLtncy_t for the scan position and press latency definitions. Loading the ordinary lane with increasing numbers of active objects gives the means to verify the priority lanes worst case press latency stays bounded.
+	 *
+	 * @param lanePrty The lane priority.
+	 *
+	 * @return A MpbPollLaneLtncy_t structure holding the lane latency values, all of them 0 if the lanePrty value is out of range.
+	 *
+	 * @note The scan position uses the Cortex-M DWT cycles counter, see getPollPrdStts(). The press latency adds the ticks elapsed from the press validation due time to the scan start, in the system tick resolution, to the cycles elapsed from the scan start to the object's service end. The time from the input edge to it's first detection by a scan is not included.
+	 * @note A press is measured when it changes the object's outputs, as the states machines of some classes take more than one service to reflect a validated press in their outputs the whole scan periods waited are included in the press latency.
+	 */
+	MpbPollLaneLtncy_t getLaneLtncy(const uint8_t &lanePrty);
+	/**
+	 * @brief Returns the number of input reads executed by the last scan
+	 *
+	 * With the ports snapshot active each GPIO port with registered objects is read once per scan, with the snapshot not active each serviced object reads it's own pin. The value, compared with the scan time reported by getLaneLtncy(const uint8_t&) for the ordinary lane, gives the means to evaluate the ports snapshot benefits.
+	 *
+	 * @return The quantity of GPIO input data register reads executed by the last scan.
+	 */
+	const unsigned long int getLastScanInptRdsQty() const;
+	/**
+	 * @brief Returns the statistics of the measured time between consecutive scans
+	 *
+	 * The period between scans is measured for both the timer and the poller task driven scans, giving the means to compare the sampling determinism of both mechanisms. The measurements are restarted when the scans are started, paused, resumed, or by the resetPollPrdStts() method.
+	 *
+	 * @return A MpbPollPrdStts_t structure holding the number of periods measured, and the minimum, maximum and mean period values in microseconds.
+	 *
+	 * @note The measurement uses the Cortex-M DWT cycles counter, that is enabled by the begin(const unsigned long int) and beginTask(const unsigned long int, const UBaseType_t, const configSTACK_DEPTH_TYPE) methods. The cycles counter wraps around after 2^32 core clock cycles, so the periods longer than that time (about 25 seconds at 168 MHz) are not correctly measured.
+	 */
+	MpbPollPrdStts_t getPollPrdStts();
+	/**
+	 * @brief Returns the time between services of each registered object
+	 *
+	 * In staggered scans mode (see setStggrd(const bool&)) the scans are executed every tick, but each object is serviced once every polling delay.
+	 *
+	 * @return The polling delay in milliseconds, as set by begin(const unsigned long int), beginTask(const unsigned long int, const UBaseType_t, const configSTACK_DEPTH_TYPE) or by the MPBttnRtSchdlr owning the group. 0 if the group was never started.
+	 */
+	const unsigned long int getPollDelay() const;
+	/**
+	 * @brief Returns the setting of the ports snapshot mode
+	 *
+	 * See setPortsSnpsht(const bool&).
+	 *
+	 * @return The ports snapshot mode setting.
+	 */
+	const bool getPortsSnpsht() const;
+	/**
+	 * @brief Returns the statistics of the number of MPB objects serviced by each scan
+	 *
+	 * An object is counted as serviced when the scan either updates it or reads it's input to check if it must be woken up (see scanMPBttns()). The measurements are restarted when the scans are started, or by the resetPollTckLd() method.
+	 *
+	 * @return A MpbPollTckLd_t structure holding the number of scans measured, and the minimum, maximum and mean number of objects serviced by each scan.
+	 */
+	MpbPollTckLd_t getPollTckLd();
+	/**
+	 * @brief Returns the setting of the staggered scans mode
+	 *
+	 * See setStggrd(const bool&).
+	 *
+	 * @return The staggered scans mode setting.
+	 */
+	const bool getStggrd() const;
+	/**
+	 * @brief Returns the setting of the vertical counters debouncing mode
+	 *
+	 * See setVrtclDbnc(const bool&, const uint8_t&).
+	 *
+	 * @return The vertical counters debouncing mode setting.
+	 */
+	const bool getVrtclDbnc() const;
+	/**
+	 * @brief Stops the Poll Group's timer without deleting it, or pauses the poller task.
+	 *
+	 * The poller task is not suspended from outside, as it might be in the middle of a scan holding the objects list mutex. The pause is requested, and the poller task honours it between scans, waiting for a resume() notification.
+	 *
+	 * @return Boolean indicating the success of the operation.
+	 * @retval true: the timer was stopped or the task pause requested. A scan in progress when the method is invoked is completed.
+	 * @retval false: there was no timer nor task to stop, or the timer could not be stopped.
+	 */
+	virtual bool pause();
+	/**
+	 * @brief Restarts the priority lanes latency measurements
+	 *
+	 * See getLaneLtncy(const uint8_t&).
+	 */
+	void resetLanesLtncy();
+	/**
+	 * @brief Restarts the scan period measurements
+	 *
+	 * See getPollPrdStts().
+	 */
+	void resetPollPrdStts();
+	/**
+	 * @brief Restarts the scans load measurements
+	 *
+	 * See getPollTckLd().
+	 */
+	void resetPollTckLd();
+	/**
+	 * @brief Restarts the Poll Group's timer stopped, or the poller task paused, by pause().
+	 *
+	 * @return Boolean indicating the success of the operation.
+	 * @retval true: the timer was restarted or the task notified to resume.
+	 * @retval false: there was no timer nor task to restart, or the timer could not be restarted.
+	 */
+	virtual bool resume();
+	/**
+	 * @brief Removes a MPB object from the Poll Group
+	 *
+	 * @param mpbObj Pointer to the MPB object to be removed from the Poll Group.
+	 *
+	 * @return Boolean indicating if the object was removed from the Poll Group.
+	 * @retval true: the object was found in the group and removed.
+	 * @retval false: the object was not registered in the group, or the objects list mutex is not available.
+	 */
+	virtual bool rmvMPBttn(DbncdMPBttn* mpbObj);
+	/**
+	 * @brief Executes one update pass over all the registered MPB objects
+	 *
+	 * This is the method executed by the Poll Group's timer on each expiration. It's made public to let the group be serviced by other means than the group's own timer (a dedicated task, a hardware timer related mechanism, or a test or benchmark harness), in which case begin(const unsigned long int) must not be invoked.
+	 *
+	 * The objects that reach a stable state, with no input change being processed and no pending requests, are left dormant: the scan only reads their input, and updates them when the input changes, when a method invoked sets a condition to be solved by their state machine, or when their next deadline (see DbncdMPBttn::getNxtDdln()) expires. The deadlines are kept in a MPBttnTmrWhl object, so the update work of each scan depends on the number of objects with activity or with expired deadlines, not on the number of objects registered.
+	 *
+	 * In staggered scans mode each pass services only the objects of the current phase, and moves on to the next phase. See setStggrd(const bool&).
+	 *
+	 * @note If the objects list mutex is being held by an add or remove operation the pass is skipped without blocking.
+	 */
+	void scanMPBttns();
+	/**
+	 * @brief Sets the staggered scans mode
+	 *
+	 * Many MPB objects started in a row with the same poll period get their timers expiring in the same tick, and the timer daemon task executes all their updates back to back, producing a load spike in that tick and nothing in the rest of the period. The staggered scans mode spreads the objects updates evenly through the poll period: the group's timer or poller task executes a scan every tick, and the registered objects are distributed in as many phases as ticks the poll period has, each scan servicing the objects of one phase. Each object is still serviced once every poll period.
+	 *
+	 * The phases are balanced when the group is started. An ordinary lane object registered afterwards is assigned to the least loaded phase, and every object keeps it's phase until it's removed, so removing an object never moves the other objects to another phase: no object is skipped or serviced twice in a poll period.
+	 *
+	 * @param newStggrd The new staggered scans mode setting.
+	 *
+	 * @return Boolean indicating if the setting was changed.
+	 * @retval true: the setting was changed, or it was already the one requested.
+	 * @retval false: the group's timer or poller task is running, or the group is a rate group of a running MPBttnRtSchdlr object, the setting must be done before starting the group.
+	 *
+	 * @note For a rate group of a MPBttnRtSchdlr object the phases are the scheduler's base ticks in the rate group period, and the rate group is scanned every base tick.
+	 * @note The scan period statistics (see getPollPrdStts()) measure the time between consecutive scans, that is the tick period in staggered scans mode.
+	 */
+	bool setStggrd(const bool &newStggrd);
+	/**
+	 * @brief Sets the vertical counters debouncing mode
+	 *
+	 * Each registered object debounces it's own input, with it's own timestamps and system tick count readings. With the vertical counters debouncing mode active, the inputs are debounced for a whole port at once as part of the ports snapshot (see setPortsSnpsht(const bool&)): each pin has a small counter, with it's bits kept in bit-sliced words so the counters of the 16 port pins are updated by a few bitwise operations per scan, and a pin level is accepted when it keeps the same value for 2^dbncCntrBits consecutive scans. The objects receive their already debounced input, and their own debounce time is not applied.
+	 *
+	 * @param newVrtclDbnc The new vertical counters debouncing mode setting.
+	 * @param dbncCntrBits (Optional) The counters bits quantity, in the range 1 to 4. The debounce time is 2^dbncCntrBits times the scan period, so the value must be chosen to keep that time over the minimum debouncing time needed by the MPBs used.
+	 *
+	 * @return Boolean indicating if the setting was changed.
+	 * @retval true: the setting was changed, or it was already the one requested.
+	 * @retval false: the dbncCntrBits value is out of range, or the objects list mutex is not available.
+	 *
+	 * @note Only the objects taking their input from the ports snapshot are debounced by the vertical counters, the setting has no effect while the ports snapshot mode is not active. In staggered scans mode (see setStggrd(const bool&)) the counters are updated every tick.
+	 */
+	bool setVrtclDbnc(const bool &newVrtclDbnc, const uint8_t &dbncCntrBits = 2);
+	/**
+	 * @brief Sets the ports snapshot mode
+	 *
+	 * Each registered object reading it's input pin means a HAL_GPIO_ReadPin() call and a peripheral bus read per object per scan. With the ports snapshot mode active, the default setting, each scan reads the input data register (IDR) of each GPIO port with registered objects once, at the scan start, normalizes the polarity of all the port pins in a single XOR operation, and every object takes it's pressed status from that single snapshot. Besides the bus reads saving, all the objects with inputs in the same port are sampled at the same instant.
+	 *
+	 * @param newPortsSnpsht The new ports snapshot mode setting.
+	 *
+	 * @return Boolean indicating if the setting was changed.
+	 * @retval true: the setting was changed, or it was already the one requested.
+	 * @retval false: the objects list mutex is not available.
+	 */
+	bool setPortsSnpsht(const bool &newPortsSnpsht);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a DMA Sampler, a Poll Group whose MPB objects are fed with hardware timed samples of a whole GPIO port (**MPB-DS**)
+ *
+ * The MPB objects serviced by their own timer or by a Poll Group read their input pin from a software timer callback or a task, so the sampling instant depends on the FreeRTOS scheduling, and each reading costs a HAL_GPIO_ReadPin() call. The DMA Sampler removes both: a hardware timer triggers DMA transfers of the GPIO port input data register (IDR) into a circular buffer at a fixed rate, and each time half of the buffer is filled the DMA interrupt passes the new batch of samples to the timer daemon task, where the batch is fed to all the registered MPB objects at once. The sampling instants are as regular as the hardware timer, and the CPU is only used once per batch.
+ *
+ * For each registered object the batch is searched for the last input level change, and the debounce process is restarted from the time of that sample, so the debounce resolution is set by the sampling rate, not by the batch rate. After feeding the batch the registered objects are updated by a regular Poll Group scan (see MPBttnPollGrp::scanMPBttns()), so all the Poll Group features apply.
+ *
+ * The hardware resources must be configured by the developer before invoking begin(TIM_HandleTypeDef*, DMA_HandleTypeDef*):
+ * - The timer must be set to produce update events at the sampling rate passed to the constructor.
+ * - The DMA stream must be linked to the timer update request, configured in circular mode, peripheral to memory direction, memory increment enabled, half word peripheral and memory data alignment, and must have it's interrupt enabled in the NVIC.
+ *
+ * The feedSmplsBtch(const uint16_t*, const std::size_t&) method is the entry point used by the DMA events, it's made public to let the sampler be fed by other means, as a simulated DMA in a host test harness.
+ *
+ * @note All the registered MPB objects must have their input pin in the sampled GPIO port.
+ *
+ * @note Only some DMA controllers can reach the GPIO ports, and only some streams/channels are linked to each timer update request, check the reference manual of the MCU in use.
+ *
+ * @class MPBttnDmaSmplr
+ */
+class MPBttnDmaSmplr: public MPBttnPollGrp{
+protected:
+	unsigned long int _btchsCnt{0};
+	unsigned long int _btchsLstCnt{0};
+	GPIO_TypeDef* _smplPort{nullptr};
+	DMA_HandleTypeDef* _smplDmaHndl{NULL};
+	unsigned long int _smplFreqHz{0};
+	std::vector<uint16_t> _smplsBuff{};
+	TIM_HandleTypeDef* _smplTmrHndl{NULL};
+
+	static void smplsBtchPrcss(void* smplrArg, uint32_t smplsBuffHlf);
+	static void smplDmaCpltCallback(DMA_HandleTypeDef* smplDmaHndl);
+	static void smplDmaHlfCpltCallback(DMA_HandleTypeDef* smplDmaHndl);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param smplPort GPIO port to be sampled.
+	 * @param smplFreqHz (Optional) The sampling rate, in Hertz, must match the update events rate of the hardware timer used.
+	 * @param smplsBuffLen (Optional) The quantity of samples held by the circular buffer, each batch fed to the MPB objects holds half of this quantity. The batch time (smplsBuffLen / 2 / smplFreqHz) sets the time between objects updates, so it must be kept short compared to the debounce time.
+	 * @param smplrName (Optional) Base name for the DMA Sampler, see MPBttnPollGrp::MPBttnPollGrp(const std::string&).
+	 */
+	MPBttnDmaSmplr(GPIO_TypeDef* smplPort, const unsigned long int &smplFreqHz = 2000, const std::size_t &smplsBuffLen = 16, const std::string &smplrName = "DmaMpbSmplr");
+	/**
+	 * @brief Class virtual destructor
+	 *
+	 * Stops the sampling and detaches all the registered MPB objects.
+	 */
+	virtual ~MPBttnDmaSmplr();
+	/**
+	 * @brief Registers a MPB object to be fed by the DMA Sampler
+	 *
+	 * See MPBttnPollGrp::addMPBttn(DbncdMPBttn*, const uint8_t&).
+	 *
+	 * @retval false: besides the MPBttnPollGrp::addMPBttn(DbncdMPBttn*, const uint8_t&) conditions, the object's input pin is not in the sampled GPIO port.
+	 */
+	virtual bool addMPBttn(DbncdMPBttn* mpbObj, const uint8_t &lanePrty = 0);
+	/**
+	 * @brief Starts the sampling
+	 *
+	 * Sets the DMA events callbacks, starts the DMA transfers from the GPIO port input data register to the circular buffer, enables the timer update DMA request and starts the timer.
+	 *
+	 * @param smplTmrHndl Pointer to the HAL handle of the configured timer triggering the samples.
+	 * @param smplDmaHndl Pointer to the HAL handle of the configured DMA stream linked to the timer update request.
+	 *
+	 * @return Boolean indicating if the sampling is running.
+	 * @retval true: the sampling was started, or it was already running when the method was invoked.
+	 * @retval false: a handle is NULL, the buffer length is less than 2 samples, or the DMA or the timer could not be started.
+	 *
+	 * @warning The DMA handle's Parent member and transfer callbacks are set by the method, the handle must not be shared with other HAL peripheral drivers.
+	 */
+	bool begin(TIM_HandleTypeDef* smplTmrHndl, DMA_HandleTypeDef* smplDmaHndl);
+	/**
+	 * @brief Stops the sampling, the timer and the DMA transfers
+	 *
+	 * The registered MPB objects are kept, a new begin(TIM_HandleTypeDef*, DMA_HandleTypeDef*) invocation will resume their servicing.
+	 *
+	 * @return Boolean indicating the success of the operation.
+	 * @retval true: the sampling was stopped, or it was not running.
+	 * @retval false: the timer or the DMA could not be stopped.
+	 */
+	virtual bool end();
+	/**
+	 * @brief Feeds a batch of GPIO port samples to the registered MPB objects, and updates them
+	 *
+	 * The samples are considered taken at the sampling rate, the last one of the batch at the time of the invocation.
+	 *
+	 * @param smplsBtch Pointer to the first sample of the batch, each sample being the 16 bits value of the GPIO port input data register.
+	 * @param smplsQty Quantity of samples in the batch.
+	 *
+	 * @note If the objects list mutex is being held by an add or remove operation the batch is discarded without blocking, and counted as lost (see getBtchsLstCnt()).
+	 */
+	void feedSmplsBtch(const uint16_t* smplsBtch, const std::size_t &smplsQty);
+	/**
+	 * @brief Returns the number of batches fed to the registered MPB objects
+	 *
+	 * @return The quantity of batches fed since the object instantiation.
+	 */
+	const unsigned long int getBtchsCnt() const;
+	/**
+	 * @brief Returns the number of batches lost
+	 *
+	 * A batch is lost when the timer command queue is full at the DMA event, or the objects list is being modified when the batch is to be fed. A growing count indicates the timer daemon task is not keeping pace with the sampling, and the buffer length or the daemon task priority must be increased.
+	 *
+	 * @return The quantity of batches lost since the object instantiation.
+	 */
+	const unsigned long int getBtchsLstCnt() const;
+	/**
+	 * @brief Stops the sampling timer without stopping the DMA
+	 *
+	 * @return Boolean indicating the success of the operation.
+	 * @retval true: the timer was stopped.
+	 * @retval false: the sampling is not running, or the timer could not be stopped.
+	 */
+	virtual bool pause();
+	/**
+	 * @brief Restarts the sampling timer stopped by pause()
+	 *
+	 * @return Boolean indicating the success of the operation.
+	 * @retval true: the timer was restarted.
+	 * @retval false: the sampling is not running, or the timer could not be restarted.
+	 */
+	virtual bool resume();
+	/**
+	 * @brief Removes a MPB object from the DMA Sampler, the object returns to read it's input pin
+	 *
+	 * See MPBttnPollGrp::rmvMPBttn(DbncdMPBttn*).
+	 */
+	virtual bool rmvMPBttn(DbncdMPBttn* mpbObj);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a Rate Groups Scheduler, a single scan engine servicing MPB objects at different poll rates (**MPB-RS**)
+ *
+ * Not every input needs the same sampling rate: an emergency stop might need to be sampled every millisecond, while an operator panel is fine at 20 milliseconds and a maintenance key at 100 milliseconds. The Rate Groups Scheduler works as a PLC task classes scheduler: a single poller task wakes up every base tick, and scans each of it's rate groups when the group's period is due. Each rate group is a MPBttnPollGrp object created and owned by the scheduler, holding the MPB objects registered with that rate.
+ *
+ * In each base tick the due groups are scanned from the fastest to the slowest rate, and the time spent in each group's scans is measured with the core cycles counter, to report each group's CPU load (see getRtGrpLd(const unsigned long int&)).
+ *
+ * A rate group set to the staggered scans mode (see MPBttnPollGrp::setStggrd(const bool&)) before the scheduler is started is scanned every base tick, each scan servicing the objects of one phase, the rate group period holding as many phases as base ticks.
+ *
+ * @note The rate groups periods must be multiples of the base tick period.
+ *
+ * @class MPBttnRtSchdlr
+ */
+class MPBttnRtSchdlr{
+protected:
+	struct MpbRtGrp_t{
+		MPBttnPollGrp* rtGrp;
+		unsigned long int rtMs;
+		unsigned long int rtTcks;
+		unsigned long int scansCnt;
+		uint32_t scanMaxCycs;
+		unsigned long long int scansCycs;
+	};
+
+	unsigned long int _baseTckMs{0};
+	unsigned long long int _ldElpsdCycs{0};
+	uint32_t _ldLastCycCnt{0};
+	bool _ldRsync{true};
+	std::vector<MpbRtGrp_t> _rtGrpsLst{};
+	SemaphoreHandle_t _schdlrMtx{NULL};
+	std::string _schdlrName{""};
+	TaskHandle_t _schdlrTaskHndl{NULL};
+	unsigned long int _tcksCnt{0};
+
+	MpbRtGrp_t* _getRtGrp(const unsigned long int &rtMs);
+	static void schdlrTask(void* schdlrTaskArg);
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param schdlrName (Optional) Base name for the scheduler's poller task and rate groups.
+	 */
+	MPBttnRtSchdlr(const std::string &schdlrName = "RtMpbSchdlr");
+	/**
+	 * @brief Class virtual destructor
+	 *
+	 * Deletes the poller task, and the rate groups detaching all the registered MPB objects.
+	 */
+	virtual ~MPBttnRtSchdlr();
+	/**
+	 * @brief Registers a MPB object in the rate group of the period requested
+	 *
+	 * If no rate group with the requested period exists it's created.
+	 *
+	 * @param mpbObj Pointer to the MPB object to be added.
+	 * @param rtMs (Optional) The rate group period, in milliseconds.
+	 * @param lanePrty (Optional) The priority lane of the object in the rate group, see MPBttnPollGrp::addMPBttn(DbncdMPBttn*, const uint8_t&).
+	 *
+	 * @return Boolean indicating if the object was registered.
+	 * @retval true: the object was registered in the rate group, or it was already registered in it.
+	 * @retval false: the rtMs value is 0, the rate group doesn't exist and the scheduler is running (rate groups can only be created before begin() is invoked), or the rate group didn't accept the object (see MPBttnPollGrp::addMPBttn(DbncdMPBttn*, const uint8_t&)).
+	 */
+	bool addMPBttn(DbncdMPBttn* mpbObj, const unsigned long int &rtMs = _StdPollDelay, const uint8_t &lanePrty = 0);
+	/**
+	 * @brief Starts the scheduler's poller task
+	 *
+	 * @param baseTckMs (Optional) The base tick period, in milliseconds.
+	 * @param taskPrty (Optional) The poller task priority.
+	 * @param stackDepth (Optional) The poller task stack depth, in words. The functions executed by the MPBs when their state changes run in the poller task, so it must be sized according to them.
+	 *
+	 * @return Boolean indicating if the poller task is running.
+	 * @retval true: the task was created, or it was already running when the method was invoked.
+	 * @retval false: the baseTckMs value is 0, a rate group period is not a multiple of the base tick period, or the task could not be created.
+	 */
+	bool begin(const unsigned long int &baseTckMs = 1, const UBaseType_t &taskPrty = configMAX_PRIORITIES - 1, const configSTACK_DEPTH_TYPE &stackDepth = configMINIMAL_STACK_SIZE * 2);
+	/**
+	 * @brief Stops the poller task and deletes it
+	 *
+	 * The rate groups and their registered MPB objects are kept, a new begin(const unsigned long int, const UBaseType_t, const configSTACK_DEPTH_TYPE) invocation will resume their servicing.
+	 *
+	 * @warning The method must not be invoked from the poller task itself, i.e. from a function executed by a MPB serviced by the scheduler.
+	 */
+	void end();
+	/**
+	 * @brief Returns the rate group of the period requested
+	 *
+	 * The rate group might be used to set the Poll Group attributes, as setStggrd(const bool&) before the scheduler is started, or to get it's statistics.
+	 *
+	 * @param rtMs The rate group period, in milliseconds.
+	 *
+	 * @return A pointer to the rate group, or nullptr if no rate group with that period exists.
+	 *
+	 * @warning The rate group is owned by the scheduler, it must not be started nor deleted.
+	 */
+	MPBttnPollGrp* getRtGrp(const unsigned long int &rtMs);
+	/**
+	 * @brief Returns the CPU load of the rate group of the period requested
+	 *
+	 * The measurements are restarted when the scheduler is started, or by the resetRtGrpsLd() method.
+	 *
+	 * @param rtMs The rate group period, in milliseconds.
+	 *
+	 * @return A MpbRtGrpLd_t structure holding the rate group load values, all of them 0 if no rate group with that period exists.
+	 *
+	 * @note The measurement uses the Cortex-M DWT cycles counter, that is enabled by the begin(const unsigned long int, const UBaseType_t, const configSTACK_DEPTH_TYPE) method. The time the poller task is preempted in the middle of a scan is counted as the rate group's load.
+	 */
+	MpbRtGrpLd_t getRtGrpLd(const unsigned long int &rtMs);
+	/**
+	 * @brief Returns the number of rate groups
+	 *
+	 * @return The quantity of rate groups created.
+	 */
+	const std::size_t getRtGrpsQty() const;
+	/**
+	 * @brief Restarts the rate groups load measurements
+	 *
+	 * See getRtGrpLd(const unsigned long int&).
+	 */
+	void resetRtGrpsLd();
+	/**
+	 * @brief Removes a MPB object from the rate group it's registered in
+	 *
+	 * @param mpbObj Pointer to the MPB object to be removed.
+	 *
+	 * @return Boolean indicating if the object was removed.
+	 * @retval true: the object was found in a rate group and removed.
+	 * @retval false: the object was not registered in any rate group of the scheduler, or the rate group objects list mutex is not available.
+	 */
+	bool rmvMPBttn(DbncdMPBttn* mpbObj);
+};
+
+//==========================================================>>
+
+/**
+ * @brief GPIO port accessor type, resolves a GPIO port from it's base address at compile time
+ *
+ * Provides the port to a GpioPin type for the target platform, i.e. GpioPortAddr<GPIOB_BASE>. Any other type providing a static get() method returning a GPIO_TypeDef pointer can be used in it's place, as a type returning a fake registers block for host side testing:
+ *
+ * @code
+ * GPIO_TypeDef fakeGpioB{};
+ * struct FakePortB{ static GPIO_TypeDef* get(){ return &fakeGpioB; } };
+ * PinBndMPBttn<GpioPin<FakePortB, GPIO_PIN_3>> tstBttn(true, true, 50);
+ * @endcode
+ *
+ * @tparam portAddr The GPIO port base address.
+ *
+ * @struct GpioPortAddr
+ */
+template <uintptr_t portAddr>
+struct GpioPortAddr{
+	static inline GPIO_TypeDef* get(){
+		return reinterpret_cast<GPIO_TypeDef*>(portAddr);
+	}
+};
+
+/**
+ * @brief GPIO pin type, binds a GPIO port and pin at compile time
+ *
+ * @tparam Port The port accessor type, see GpioPortAddr.
+ * @tparam pinMsk The pin represented as a single-bit mask, as the GPIO_PIN_x HAL constants.
+ *
+ * @struct GpioPin
+ */
+template <typename Port, uint16_t pinMsk>
+struct GpioPin{
+	static const uint16_t pinNum {pinMsk};
+
+	static inline GPIO_TypeDef* port(){
+		return Port::get();
+	}
+	static inline uint32_t read(){
+		return Port::get()->IDR & pinMsk;
+	}
+};
+
+/**
+ * @brief Alias of a GpioPin bound to a port by it's base address, i.e. GpioAddrPin<GPIOB_BASE, GPIO_PIN_3>
+ */
+template <uintptr_t portAddr, uint16_t pinMsk>
+using GpioAddrPin = GpioPin<GpioPortAddr<portAddr>, pinMsk>;
+
+/**
+ * @brief Models a Pin Bound MPB, any class of the DbncdMPBttn hierarchy with it's input pin bound at compile time (**PB-MPB**)
+ *
+ * The MPB classes keep their input port and pin as attributes, so each input reading goes through a pointer and a mask loaded at runtime. The Pin Bound MPB template adds a compile time pin to any of the MPB classes: the input reading becomes a single load from a constant register address, masked by a constant, that the compiler can inline in the update sequence. All the attributes, methods and services of the MPB class used as base are kept, and the objects are handled as any other object of the hierarchy.
+ *
+ * The constructor takes the same parameters of the base class constructor, except the port and pin ones:
+ *
+ * @code
+ * PinBndMPBttn<GpioAddrPin<GPIOC_BASE, GPIO_PIN_13>, TgglLtchMPBttn> tstBttn(true, true, 50);
+ * @endcode
+ *
+ * @tparam Pin The GpioPin type of the input pin.
+ * @tparam MpbBase (Optional) The MPB class to be pin bound.
+ *
+ * @note The port and pin are still kept by the base class attributes, as they are needed by the pin configuration, the EXTI triggered mode and the Poll Groups ports snapshot. Objects taking their input from a Poll Group's ports snapshot, from a MPBttnDmaSmplr or from an input source (see MPBttnInptSrc) use the base class reading.
+ *
+ * @class PinBndMPBttn
+ */
+template <typename Pin, typename MpbBase = DbncdMPBttn>
+class PinBndMPBttn: public MpbBase{
+protected:
+	virtual bool _rdIsPressed(){
+		if(this->_xtrnSmplng || (this->_portSnpsht != nullptr) || (this->_inptSrc != nullptr))
+			return MpbBase::_rdIsPressed();
+
+		return (((Pin::read()) ^ this->_prssdLvlInvMsk) & Pin::pinNum) != 0;
+	}
+	virtual bool updIsPressed(){
+		if(this->_xtrnSmplng || (this->_portSnpsht != nullptr) || (this->_inptSrc != nullptr))
+			return MpbBase::updIsPressed();
+		this->_isPressed = PinBndMPBttn::_rdIsPressed();
+
+		return this->_isPressed;
+	}
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mpbArgs The parameters of the MpbBase class constructor following the port and pin parameters.
+	 */
+	template <typename... MpbArgs>
+	PinBndMPBttn(const MpbArgs&... mpbArgs)
+	:MpbBase(Pin::port(), Pin::pinNum, mpbArgs...)
+	{
+	}
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~PinBndMPBttn(){}
+};
+
+//==========================================================>>
+
+/**
+ * @brief Debounce policy of the timestamp since first detection scheme
+ *
+ * The input level is passed through unchanged, the debouncing is done by the MPB classes themselves, validating a press (or release) when the input kept the level for the debounce time since it was first detected. It's the debouncing of the MPB classes with no policy set, see DbncdMPBttn::setDbncTime(const unsigned long int&).
+ *
+ * @struct TmStmpDbncPlcy
+ */
+struct TmStmpDbncPlcy{
+	static const bool plcyDbncd{false};	/**< The policy output is not debounced, the MPB class debounce time is kept*/
+	struct Stt_t{};	/**< The policy keeps no state*/
+
+	static bool isStbl(const Stt_t &){
+		return true;
+	}
+	static bool updt(Stt_t &, const bool &rawPrssd, const bool &){
+		return rawPrssd;
+	}
+};
+
+/**
+ * @brief Debounce policy of the saturating integrator counter scheme
+ *
+ * A counter is incremented for each pressed sample and decremented for each released sample, saturating at 0 and at intgrtrMax. The debounced level changes to pressed when the counter reaches intgrtrMax, and to released when it reaches 0, so isolated noise samples are integrated out instead of restarting the debounce process.
+ *
+ * @tparam intgrtrMax The counter saturation value, the minimum quantity of samples to validate a level change. The debounce time is intgrtrMax times the polling period.
+ *
+ * @struct IntgrtrDbncPlcy
+ */
+template <uint8_t intgrtrMax = 4>
+struct IntgrtrDbncPlcy{
+	static const bool plcyDbncd{true};	/**< The policy output is debounced, the MPB class debounce time is skipped*/
+	struct Stt_t{
+		uint8_t intgrtr{0};
+	};
+
+	static bool isStbl(const Stt_t &plcyStt){
+		return (plcyStt.intgrtr == 0) || (plcyStt.intgrtr == intgrtrMax);
+	}
+	static bool updt(Stt_t &plcyStt, const bool &rawPrssd, const bool &prvPrssd){
+		if(rawPrssd){
+			if(plcyStt.intgrtr < intgrtrMax)
+				++plcyStt.intgrtr;
+		}
+		else if(plcyStt.intgrtr > 0){
+			--plcyStt.intgrtr;
+		}
+
+		return (plcyStt.intgrtr == intgrtrMax) || (prvPrssd && (plcyStt.intgrtr != 0));
+	}
+};
+
+/**
+ * @brief Debounce policy of the shift register pattern matching scheme
+ *
+ * Each sample is shifted into a 16 bits history register, a released sample as a 1 bit and a pressed sample as a 0 bit. The debounced level changes to pressed when the history bits selected by the pattern mask match the press pattern, and to released when they match the release pattern. The default press pattern 0xF000 describes 4 released samples followed by 12 pressed samples, the default release pattern 0x0FFF the opposite sequence. The default mask 0x0FFF compares only the 12 latest samples, as a bouncing input seldom gives clean released samples just before the stable pressed ones: a full 0xFFFF mask requires the exact sequence, rejecting the level changes with bounces in the masked out samples.
+ *
+ * @tparam prssPtrn The history pattern validating a press.
+ * @tparam rlsPtrn The history pattern validating a release.
+ * @tparam ptrnMsk The history bits compared to the patterns.
+ *
+ * @struct ShftPtrnDbncPlcy
+ */
+template <uint16_t prssPtrn = 0xF000, uint16_t rlsPtrn = 0x0FFF, uint16_t ptrnMsk = 0x0FFF>
+struct ShftPtrnDbncPlcy{
+	static const bool plcyDbncd{true};	/**< The policy output is debounced, the MPB class debounce time is skipped*/
+	struct Stt_t{
+		uint16_t hstry{0xFFFF};
+	};
+
+	static bool isStbl(const Stt_t &plcyStt){
+		return (plcyStt.hstry == 0x0000) || (plcyStt.hstry == 0xFFFF);
+	}
+	static bool updt(Stt_t &plcyStt, const bool &rawPrssd, const bool &prvPrssd){
+		plcyStt.hstry = (plcyStt.hstry << 1) | ((rawPrssd)?0:1);
+
+		return ((plcyStt.hstry & ptrnMsk) == (prssPtrn & ptrnMsk)) || (prvPrssd && ((plcyStt.hstry & ptrnMsk) != (rlsPtrn & ptrnMsk)));
+	}
+};
+
+/**
+ * @brief Debounce policy of the eager lock-out scheme
+ *
+ * The first sample of a level change is reported at once, and the input is ignored for the lock-out window that follows, so the bounces of the change are ignored instead of waited for. The level change is reported with no debouncing latency, at the cost of reporting noise spikes as level changes: the optional glitch check retracts the reported change if the input doesn't keep the new level glchChkSmpls samples after the change, reporting back the previous level and ending the lock-out window.
+ *
+ * @tparam lckOutSmpls The lock-out window length, in samples. The lock-out time is lckOutSmpls times the polling period.
+ * @tparam glchChkSmpls (Optional) The samples from the level change to the glitch check, 0 for no glitch check. Must be less than lckOutSmpls to be applied.
+ *
+ * @struct LckOutDbncPlcy
+ */
+template <uint8_t lckOutSmpls = 4, uint8_t glchChkSmpls = 0>
+struct LckOutDbncPlcy{
+	static const bool plcyDbncd{true};	/**< The policy output is debounced, the MPB class debounce time is skipped*/
+	struct Stt_t{
+		uint8_t lckOutCnt{0};
+		uint8_t smplsSncChng{0};
+	};
+
+	static bool isStbl(const Stt_t &plcyStt){
+		return plcyStt.lckOutCnt == 0;
+	}
+	static bool updt(Stt_t &plcyStt, const bool &rawPrssd, const bool &prvPrssd){
+		bool result {rawPrssd};
+
+		if(plcyStt.lckOutCnt > 0){
+			--plcyStt.lckOutCnt;
+			++plcyStt.smplsSncChng;
+			result = prvPrssd;
+			if((glchChkSmpls > 0) && (plcyStt.smplsSncChng == glchChkSmpls) && (rawPrssd != prvPrssd)){
+				//The change didn't hold, it's retracted
+				plcyStt.lckOutCnt = 0;
+				result = rawPrssd;
+			}
+		}
+		else if(rawPrssd != prvPrssd){
+			plcyStt.lckOutCnt = lckOutSmpls;
+			plcyStt.smplsSncChng = 0;
+		}
+
+		return result;
+	}
+};
+
+/**
+ * @brief Template class adding a compile time selected debounce policy to a MPB class (**DP-MPB**)
+ *
+ * The pressed status read by the MpbBase class is fed to the Plcy debounce policy at each poll, and the policy output replaces it as the MPB pressed status. For the policies producing a debounced output (Plcy::plcyDbncd) the MpbBase class debounce time is skipped, only the start delay and the state machine logic are kept, as for the inputs debounced by other means. The policy is attached by overriding the virtual updIsPressed() method, invoked through the vtable at every poll as for any class of the hierarchy. The policy methods are static, resolved at compile time and inlined in that override, so each class of the hierarchy might use any policy with no further virtual dispatch.
+ *
+ * The policies count samples, not time: the debounce time of the IntgrtrDbncPlcy and ShftPtrnDbncPlcy policies is set by their template parameters and the polling period.
+ *
+ * @code{.cpp}
+ * DbncPlcyMPBttn<IntgrtrDbncPlcy<8>, TgglLtchMPBttn> tstBttn(GPIOC, GPIO_PIN_13, true, true);
+ * DbncPlcyMPBttn<ShftPtrnDbncPlcy<>, PinBndMPBttn<GpioAddrPin<GPIOC_BASE, GPIO_PIN_13>>> tstPinBndBttn(true, true);
+ * @endcode
+ *
+ * @tparam Plcy The debounce policy, TmStmpDbncPlcy, IntgrtrDbncPlcy, ShftPtrnDbncPlcy or LckOutDbncPlcy, or any struct providing the same members.
+ * @tparam MpbBase (Optional) The MPB class to be debounced by the policy.
+ *
+ * @note To combine a debounce policy with a pin binding the policy must wrap the pin bound class, as the example shows.
+ * @note The constructor parameters are forwarded with their deduced types, so a null port (i.e. for an object getting it's input from an input source) must be passed as nullptr, not as NULL.
+ *
+ * @class DbncPlcyMPBttn
+ */
+template <typename Plcy, typename MpbBase = DbncdMPBttn>
+class DbncPlcyMPBttn: public MpbBase{
+protected:
+	bool _plcyPrssd{false};
+	typename Plcy::Stt_t _plcyStt{};
+
+	virtual bool _isStbl(){
+		return Plcy::isStbl(_plcyStt) && MpbBase::_isStbl();
+	}
+	virtual bool updIsPressed(){
+		bool rawPrssd {MpbBase::updIsPressed()};
+
+		if(Plcy::plcyDbncd){
+			_plcyPrssd = Plcy::updt(_plcyStt, rawPrssd, _plcyPrssd);
+			this->_isPressed = _plcyPrssd;
+		}
+
+		return this->_isPressed;
+	}
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mpbArgs The parameters of the MpbBase class constructor.
+	 */
+	template <typename... MpbArgs>
+	DbncPlcyMPBttn(const MpbArgs&... mpbArgs)
+	:MpbBase(mpbArgs...)
+	{
+		this->_plcyDbncd = Plcy::plcyDbncd;	//The debounced policy output skips the MpbBase class debounce time
+	}
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~DbncPlcyMPBttn(){}
 };
 
 //==========================================================>>